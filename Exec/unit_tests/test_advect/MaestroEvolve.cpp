@@ -203,4 +203,203 @@ Maestro::Evolve ()
 			}
 		}
 	}
+
+	// -------------------------------------------------------------------------
+	//  PPM kernel benchmark: the cell by cell kernels against ppm_edge_once,
+	//  on the final density, with EXT_DIR on every side so that the
+	//  boundary stencils are compared as well
+	// -------------------------------------------------------------------------
+
+	{
+		const int lev = finest_level;
+		const Box& domainBox = geom[lev].Domain();
+		const auto dx = geom[lev].CellSizeArray();
+		const int nrep = 10;
+
+		Vector<BCRec> bcs_ext(1);
+		for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+			bcs_ext[0].setLo(d, EXT_DIR);
+			bcs_ext[0].setHi(d, EXT_DIR);
+		}
+
+		MultiFab Ip_mf[2];
+		MultiFab Im_mf[2];
+		for (int engine = 0; engine <= 1; ++engine) {
+			Ip_mf[engine].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 0);
+			Im_mf[engine].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 0);
+			Ip_mf[engine].setVal(0.);
+			Im_mf[engine].setVal(0.);
+		}
+
+		const int ppm_type_save = ppm_type;
+		const bool ppm_edge_once_save = ppm_edge_once;
+
+		for (int type = 1; type <= 2; ++type) {
+
+			// PPM calls the kernel chosen for ppm_type in Setup
+			ppm_type = type;
+			SelectPPMKernel();
+			Real time[2];
+
+			for (int engine = 0; engine <= 1; ++engine) {
+
+				ppm_edge_once = engine;
+
+				const Real strt_time = ParallelDescriptor::second();
+
+				for (int rep = 0; rep < nrep; ++rep) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+					for (MFIter mfi(sold[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+						const Box& tileBox = mfi.tilebox();
+
+						PPM(tileBox, sold[lev].array(mfi),
+						    umac[lev][0].array(mfi), umac[lev][1].array(mfi),
+#if (AMREX_SPACEDIM == 3)
+						    umac[lev][2].array(mfi),
+#endif
+						    Ip_mf[engine].array(mfi), Im_mf[engine].array(mfi),
+						    domainBox, bcs_ext, dx, true, Rho, 0);
+					}
+				}
+
+				time[engine] = ParallelDescriptor::second() - strt_time;
+				ParallelDescriptor::ReduceRealMax(time[engine], ParallelDescriptor::IOProcessorNumber());
+			}
+
+			MultiFab::Subtract(Ip_mf[1], Ip_mf[0], 0, 0, AMREX_SPACEDIM, 0);
+			MultiFab::Subtract(Im_mf[1], Im_mf[0], 0, 0, AMREX_SPACEDIM, 0);
+			Real max_diff = 0.0;
+			for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+				max_diff = max(max_diff, max(Ip_mf[1].norm0(d), Im_mf[1].norm0(d)));
+			}
+
+			Print() << "\nppm_type = " << type << ", " << nrep << " calls:" << std::endl;
+			Print() << "\tcell by cell: " << time[0] << " s" << std::endl;
+			Print() << "\tedge once:    " << time[1] << " s" << std::endl;
+			Print() << "\tmax difference in Ip, Im: " << max_diff << std::endl;
+		}
+
+		ppm_type = ppm_type_save;
+		ppm_edge_once = ppm_edge_once_save;
+		SelectPPMKernel();
+	}
+
+	// -------------------------------------------------------------------------
+	//  PPM symmetry test: a profile along x and the same profile along y,
+	//  advected by the same velocity profile, with EXT_DIR on every side.
+	//  The x interface states of the first must equal the y interface
+	//  states of the second, including the cells next to the boundaries.
+	// -------------------------------------------------------------------------
+
+	{
+		const Box& domainBox = geom[0].Domain();
+		const auto dx = geom[0].CellSizeArray();
+
+		if (domainBox.length(0) == domainBox.length(1) && dx[0] == dx[1]) {
+
+			Vector<BCRec> bcs_ext(1);
+			for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+				bcs_ext[0].setLo(d, EXT_DIR);
+				bcs_ext[0].setHi(d, EXT_DIR);
+			}
+
+			// the whole domain as a single box, so that the transpose of a
+			// cell is in the same box
+			const BoxArray ba(domainBox);
+			const DistributionMapping dm(ba);
+			const int ng = 4;
+
+			MultiFab sx(ba, dm, 1, ng);
+			MultiFab sy(ba, dm, 1, ng);
+			std::array< MultiFab, AMREX_SPACEDIM > uface;
+			AMREX_D_TERM(uface[0].define(convert(ba,nodal_flag_x), dm, 1, ng); ,
+			             uface[1].define(convert(ba,nodal_flag_y), dm, 1, ng); ,
+			             uface[2].define(convert(ba,nodal_flag_z), dm, 1, ng); );
+			MultiFab Ipx(ba, dm, AMREX_SPACEDIM, 0);
+			MultiFab Imx(ba, dm, AMREX_SPACEDIM, 0);
+			MultiFab Ipy(ba, dm, AMREX_SPACEDIM, 0);
+			MultiFab Imy(ba, dm, AMREX_SPACEDIM, 0);
+			MultiFab diff(ba, dm, 2, 0);
+
+			// at most half a cell per time step
+			const Real umax = 0.5*dx[0]/dt;
+
+			for (MFIter mfi(sx); mfi.isValid(); ++mfi) {
+				const Array4<Real> sx_arr = sx.array(mfi);
+				const Array4<Real> sy_arr = sy.array(mfi);
+				const Array4<Real> u_arr = uface[0].array(mfi);
+				const Array4<Real> v_arr = uface[1].array(mfi);
+
+				// a rough profile, so that the limiters take all of
+				// their branches
+				AMREX_PARALLEL_FOR_3D(sx.fabbox(mfi.index()), i, j, k, {
+					sx_arr(i,j,k) = std::sin(0.7*i*i);
+					sy_arr(i,j,k) = std::sin(0.7*j*j);
+				});
+				AMREX_PARALLEL_FOR_3D(uface[0].fabbox(mfi.index()), i, j, k, {
+					u_arr(i,j,k) = umax*std::cos(1.3*i);
+				});
+				AMREX_PARALLEL_FOR_3D(uface[1].fabbox(mfi.index()), i, j, k, {
+					v_arr(i,j,k) = umax*std::cos(1.3*j);
+				});
+			}
+#if (AMREX_SPACEDIM == 3)
+			uface[2].setVal(0.);
+#endif
+
+			const int ppm_type_save = ppm_type;
+			const bool ppm_edge_once_save = ppm_edge_once;
+
+			for (int type = 1; type <= 2; ++type) {
+				ppm_type = type;
+				SelectPPMKernel();
+
+				for (int engine = 0; engine <= 1; ++engine) {
+					ppm_edge_once = engine;
+
+					for (MFIter mfi(sx); mfi.isValid(); ++mfi) {
+						const Box& bx = mfi.validbox();
+						PPM(bx, sx.array(mfi),
+						    uface[0].array(mfi), uface[1].array(mfi),
+#if (AMREX_SPACEDIM == 3)
+						    uface[2].array(mfi),
+#endif
+						    Ipx.array(mfi), Imx.array(mfi),
+						    domainBox, bcs_ext, dx, true, 0, 0);
+
+						PPM(bx, sy.array(mfi),
+						    uface[0].array(mfi), uface[1].array(mfi),
+#if (AMREX_SPACEDIM == 3)
+						    uface[2].array(mfi),
+#endif
+						    Ipy.array(mfi), Imy.array(mfi),
+						    domainBox, bcs_ext, dx, true, 0, 0);
+
+						const Array4<const Real> Ipx_arr = Ipx.array(mfi);
+						const Array4<const Real> Imx_arr = Imx.array(mfi);
+						const Array4<const Real> Ipy_arr = Ipy.array(mfi);
+						const Array4<const Real> Imy_arr = Imy.array(mfi);
+						const Array4<Real> diff_arr = diff.array(mfi);
+
+						AMREX_PARALLEL_FOR_3D(bx, i, j, k, {
+							diff_arr(i,j,k,0) = Ipx_arr(i,j,k,0) - Ipy_arr(j,i,k,1);
+							diff_arr(i,j,k,1) = Imx_arr(i,j,k,0) - Imy_arr(j,i,k,1);
+						});
+					}
+
+					const Real max_diff = max(diff.norm0(0), diff.norm0(1));
+
+					Print() << "\nPPM symmetry, ppm_type = " << type
+					        << (engine ? ", edge once" : ", cell by cell")
+					        << ": max x/y difference in Ip, Im: " << max_diff << std::endl;
+				}
+			}
+
+			ppm_type = ppm_type_save;
+			ppm_edge_once = ppm_edge_once_save;
+			SelectPPMKernel();
+		}
+	}
 }
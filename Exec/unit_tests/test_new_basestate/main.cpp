@@ -97,6 +97,43 @@ int main(int argc, char* argv[])
         Print() << "subtract in place" << std::endl;
 
         base_state -= other_base_state;
+
+        Print() << "in-place linear combination" << std::endl;
+
+        BaseState<Real> avg_state(nlevs, len, ncomp);
+        avg_state.lincomb(0.5, base_state, 0.5, other_base_state);
+
+        Print() << "does it match 0.5*(a + b)? "
+                << (avg_state == 0.5*(base_state + other_base_state)) << std::endl;
+
+        avg_state.saxpy(-0.5, other_base_state);
+
+        Print() << "does saxpy undo the second term? "
+                << (avg_state == 0.5*base_state) << std::endl;
+
+        Print() << "time the operators against lincomb" << std::endl;
+
+        const int nbench = 1000;
+        BaseState<Real> a(nlevs, 4096, 1);
+        BaseState<Real> b(nlevs, 4096, 1);
+        BaseState<Real> c(nlevs, 4096, 1);
+        a.setVal(1.0);
+        b.setVal(3.0);
+
+        Real strt = ParallelDescriptor::second();
+        for (int n = 0; n < nbench; ++n) {
+            c.copy(0.5*(a + b));
+        }
+        const Real time_ops = ParallelDescriptor::second() - strt;
+
+        strt = ParallelDescriptor::second();
+        for (int n = 0; n < nbench; ++n) {
+            c.lincomb(0.5, a, 0.5, b);
+        }
+        const Real time_lincomb = ParallelDescriptor::second() - strt;
+
+        Print() << "  c.copy(0.5*(a + b)):      " << time_ops << " s" << std::endl;
+        Print() << "  c.lincomb(0.5, a, 0.5, b): " << time_lincomb << " s" << std::endl;
     }
 
     // destroy timer for profiling
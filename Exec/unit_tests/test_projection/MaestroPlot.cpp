@@ -92,7 +92,8 @@ Maestro::PlotFileMF (const int nPlot,
                      Vector<MultiFab>& e,
                      const BaseState<Real>& f,
                      const BaseState<Real>& g,
-                     const Vector<MultiFab>& h)
+                     const Vector<MultiFab>& h,
+                     const Vector<std::string>* plot_varnames)
 {
 	// timer for profiling
 	BL_PROFILE_VAR("Maestro::PlotFileMF()", PlotFileMF);
@@ -102,7 +102,8 @@ Maestro::PlotFileMF (const int nPlot,
                      Vector<MultiFab>& s_in,
                      const BaseState<Real>& d,
                      const BaseState<Real>& e,
-                     const Vector<MultiFab>& f)
+                     const Vector<MultiFab>& f,
+                     const Vector<std::string>* plot_varnames)
 {
 	// timer for profiling
 	BL_PROFILE_VAR("Maestro::PlotFileMF()", PlotFileMF);
@@ -54,7 +54,13 @@ Real Maestro::startCPUTime = 0.0;
 
 Maestro::Maestro () = default;
 
-Maestro::~Maestro () = default;
+Maestro::~Maestro ()
+{
+    // don't leave an asynchronous checkpoint writer running
+    if (chk_thread.joinable()) {
+        chk_thread.join();
+    }
+}
 
 Real
 Maestro::getCPUTime()
@@ -104,65 +104,68 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         }
     }
 
+    // the scratch buffers from the previous step are free again
+    scratch_pool.ReleaseAll();
+
     for (int lev=0; lev<=finest_level; ++lev) {
         // cell-centered MultiFabs
-        shat        [lev].define(grids[lev], dmap[lev],   Nscal, ng_s);
-        rhohalf     [lev].define(grids[lev], dmap[lev],       1,    1);
-        cphalf      [lev].define(grids[lev], dmap[lev],       1,    1);
-        xihalf      [lev].define(grids[lev], dmap[lev], NumSpec,    1);
-        macrhs      [lev].define(grids[lev], dmap[lev],       1,    0);
-        macphi      [lev].define(grids[lev], dmap[lev],       1,    1);
-        S_cc_nph    [lev].define(grids[lev], dmap[lev],       1,    0);
-        rho_omegadot[lev].define(grids[lev], dmap[lev], NumSpec,    0);
-        diff_old    [lev].define(grids[lev], dmap[lev],       1,    0);
-        diff_new    [lev].define(grids[lev], dmap[lev],       1,    0);
-        diff_hat    [lev].define(grids[lev], dmap[lev],       1,    0);
-        diff_hterm_new[lev].define(grids[lev], dmap[lev],     1,    0);
-        diff_hterm_hat[lev].define(grids[lev], dmap[lev],     1,    0);
-        rho_Hnuc    [lev].define(grids[lev], dmap[lev],       1,    0);
-        rho_Hext    [lev].define(grids[lev], dmap[lev],       1,    0);
-        sdc_source  [lev].define(grids[lev], dmap[lev],   Nscal,    0);
-        aofs        [lev].define(grids[lev], dmap[lev],   Nscal,    0);
-        intra_rhoh0 [lev].define(grids[lev], dmap[lev],       1,    0);
-        delta_gamma1_term[lev].define(grids[lev], dmap[lev],  1,    0);
-        delta_gamma1[lev].define(grids[lev], dmap[lev],       1,    0);
-        peos_old    [lev].define(grids[lev], dmap[lev],       1,    0);
-        peosbar_cart[lev].define(grids[lev], dmap[lev],       1,    0);
-        p0_cart     [lev].define(grids[lev], dmap[lev],       1,    0);
-        delta_p_term[lev].define(grids[lev], dmap[lev],       1,    0);
-        Tcoeff1     [lev].define(grids[lev], dmap[lev],       1,    1);
-        hcoeff1     [lev].define(grids[lev], dmap[lev],       1,    1);
-        Xkcoeff1    [lev].define(grids[lev], dmap[lev], NumSpec,    1);
-        pcoeff1     [lev].define(grids[lev], dmap[lev],       1,    1);
-        Tcoeff2     [lev].define(grids[lev], dmap[lev],       1,    1);
-        hcoeff2     [lev].define(grids[lev], dmap[lev],       1,    1);
-        Xkcoeff2    [lev].define(grids[lev], dmap[lev], NumSpec,    1);
-        pcoeff2     [lev].define(grids[lev], dmap[lev],       1,    1);
+        DefineScratch(shat[lev], lev, grids[lev], Nscal, ng_s);
+        DefineScratch(rhohalf[lev], lev, grids[lev], 1, 1);
+        DefineScratch(cphalf[lev], lev, grids[lev], 1, 1);
+        DefineScratch(xihalf[lev], lev, grids[lev], NumSpec, 1);
+        DefineScratch(macrhs[lev], lev, grids[lev], 1, 0);
+        DefineScratch(macphi[lev], lev, grids[lev], 1, 1);
+        DefineScratch(S_cc_nph[lev], lev, grids[lev], 1, 0);
+        DefineScratch(rho_omegadot[lev], lev, grids[lev], NumSpec, 0);
+        DefineScratch(diff_old[lev], lev, grids[lev], 1, 0);
+        DefineScratch(diff_new[lev], lev, grids[lev], 1, 0);
+        DefineScratch(diff_hat[lev], lev, grids[lev], 1, 0);
+        DefineScratch(diff_hterm_new[lev], lev, grids[lev], 1, 0);
+        DefineScratch(diff_hterm_hat[lev], lev, grids[lev], 1, 0);
+        DefineScratch(rho_Hnuc[lev], lev, grids[lev], 1, 0);
+        DefineScratch(rho_Hext[lev], lev, grids[lev], 1, 0);
+        DefineScratch(sdc_source[lev], lev, grids[lev], Nscal, 0);
+        DefineScratch(aofs[lev], lev, grids[lev], Nscal, 0);
+        DefineScratch(intra_rhoh0[lev], lev, grids[lev], 1, 0);
+        DefineScratch(delta_gamma1_term[lev], lev, grids[lev], 1, 0);
+        DefineScratch(delta_gamma1[lev], lev, grids[lev], 1, 0);
+        DefineScratch(peos_old[lev], lev, grids[lev], 1, 0);
+        DefineScratch(peosbar_cart[lev], lev, grids[lev], 1, 0);
+        DefineScratch(p0_cart[lev], lev, grids[lev], 1, 0);
+        DefineScratch(delta_p_term[lev], lev, grids[lev], 1, 0);
+        DefineScratch(Tcoeff1[lev], lev, grids[lev], 1, 1);
+        DefineScratch(hcoeff1[lev], lev, grids[lev], 1, 1);
+        DefineScratch(Xkcoeff1[lev], lev, grids[lev], NumSpec, 1);
+        DefineScratch(pcoeff1[lev], lev, grids[lev], 1, 1);
+        DefineScratch(Tcoeff2[lev], lev, grids[lev], 1, 1);
+        DefineScratch(hcoeff2[lev], lev, grids[lev], 1, 1);
+        DefineScratch(Xkcoeff2[lev], lev, grids[lev], NumSpec, 1);
+        DefineScratch(pcoeff2[lev], lev, grids[lev], 1, 1);
         if (ppm_trace_forces == 0) {
-            scal_force  [lev].define(grids[lev], dmap[lev],   Nscal,    1);
+            DefineScratch(scal_force[lev], lev, grids[lev], Nscal, 1);
         } else {
             // we need more ghostcells if we are tracing the forces
-            scal_force  [lev].define(grids[lev], dmap[lev],   Nscal, ng_s);
+            DefineScratch(scal_force[lev], lev, grids[lev], Nscal, ng_s);
         }
-        delta_chi   [lev].define(grids[lev], dmap[lev],       1,    0);
-        sponge      [lev].define(grids[lev], dmap[lev],       1,    0);
-        w0cc    [lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 0);
+        DefineScratch(delta_chi[lev], lev, grids[lev], 1, 0);
+        DefineScratch(sponge[lev], lev, grids[lev], 1, 0);
+        DefineScratch(w0cc[lev], lev, grids[lev], AMREX_SPACEDIM, 0);
 
         // face-centered in the dm-direction (planar only)
-        AMREX_D_TERM(etarhoflux_dummy[lev].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1, 1); ,
-                     etarhoflux_dummy[lev].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1); ,
-                     etarhoflux_dummy[lev].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1); );
+        AMREX_D_TERM(DefineScratch(etarhoflux_dummy[lev], lev, convert(grids[lev],nodal_flag_x), 1, 1); ,
+                     DefineScratch(etarhoflux_dummy[lev], lev, convert(grids[lev],nodal_flag_y), 1, 1); ,
+                     DefineScratch(etarhoflux_dummy[lev], lev, convert(grids[lev],nodal_flag_z), 1, 1); );
 
         // face-centered arrays of MultiFabs
-        AMREX_D_TERM(umac [lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1,     1); ,
-                     umac [lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1,     1); ,
-                     umac [lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1,     1); );
-        AMREX_D_TERM(sedge[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], Nscal, 0); ,
-                     sedge[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], Nscal, 0); ,
-                     sedge[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], Nscal, 0); );
-        AMREX_D_TERM(sflux[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], Nscal, 0); ,
-                     sflux[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], Nscal, 0); ,
-                     sflux[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], Nscal, 0); );
+        AMREX_D_TERM(DefineScratch(umac[lev][0], lev, convert(grids[lev],nodal_flag_x), 1, 1); ,
+                     DefineScratch(umac[lev][1], lev, convert(grids[lev],nodal_flag_y), 1, 1); ,
+                     DefineScratch(umac[lev][2], lev, convert(grids[lev],nodal_flag_z), 1, 1); );
+        AMREX_D_TERM(DefineScratch(sedge[lev][0], lev, convert(grids[lev],nodal_flag_x), Nscal, 0); ,
+                     DefineScratch(sedge[lev][1], lev, convert(grids[lev],nodal_flag_y), Nscal, 0); ,
+                     DefineScratch(sedge[lev][2], lev, convert(grids[lev],nodal_flag_z), Nscal, 0); );
+        AMREX_D_TERM(DefineScratch(sflux[lev][0], lev, convert(grids[lev],nodal_flag_x), Nscal, 0); ,
+                     DefineScratch(sflux[lev][1], lev, convert(grids[lev],nodal_flag_y), Nscal, 0); ,
+                     DefineScratch(sflux[lev][2], lev, convert(grids[lev],nodal_flag_z), Nscal, 0); );
 
         // initialize umac
         for (int d=0; d < AMREX_SPACEDIM; ++d)
@@ -176,17 +179,17 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
 
 #if (AMREX_SPACEDIM == 3)
     for (int lev=0; lev<=finest_level; ++lev) {
-        w0mac[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1, 1);
-        w0mac[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1);
-        w0mac[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1);
-        w0mac_dummy[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1, 1);
-        w0mac_dummy[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1);
-        w0mac_dummy[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1);
+        DefineScratch(w0mac[lev][0], lev, convert(grids[lev],nodal_flag_x), 1, 1);
+        DefineScratch(w0mac[lev][1], lev, convert(grids[lev],nodal_flag_y), 1, 1);
+        DefineScratch(w0mac[lev][2], lev, convert(grids[lev],nodal_flag_z), 1, 1);
+        DefineScratch(w0mac_dummy[lev][0], lev, convert(grids[lev],nodal_flag_x), 1, 1);
+        DefineScratch(w0mac_dummy[lev][1], lev, convert(grids[lev],nodal_flag_y), 1, 1);
+        DefineScratch(w0mac_dummy[lev][2], lev, convert(grids[lev],nodal_flag_z), 1, 1);
     }
 #endif
     
     for (int lev=0; lev<=finest_level; ++lev) {
-        w0_force_cart_dummy[lev].define(grids[lev], dmap[lev], AMREX_SPACEDIM, 1);
+        DefineScratch(w0_force_cart_dummy[lev], lev, grids[lev], AMREX_SPACEDIM, 1);
         w0_force_cart_dummy[lev].setVal(0.);
     }
     
@@ -414,7 +417,7 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         EnforceHSE(rho0_new, p0_new, grav_cell_new);
 
         // compute p0_nph
-        p0_nph.copy(0.5*(p0_old + p0_new));
+        p0_nph.lincomb(0.5, p0_old, 0.5, p0_new);
                 
         // hold dp0/dt in psi for enthalpy advance
         psi.copy((p0_new - p0_old) / dt);
@@ -516,8 +519,12 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
     FillPatch(0.5*(t_old+t_new), rhohalf, sold, snew, Rho, 0, 1, Rho, bcs_s);
 
     if (evolve_base_state) {
-        // update base state density and pressure
-        Average(snew, rho0_new, Rho);
+        // update base state density and pressure; snew is not modified
+        // again before rhoh0_new is needed, so average both in one sweep
+        {
+            Vector<BaseState<Real>*> phibar = {&rho0_new, &rhoh0_new};
+            Average(snew, phibar, {Rho, RhoH});
+        }
         ComputeCutoffCoords(rho0_new);
         
         if (use_etarho) {
@@ -539,8 +546,7 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         // hold dp0/dt in psi for Make_S_cc
         psi.copy((p0_new - p0_old) / dt);
 
-        // update base state enthalpy
-        Average(snew, rhoh0_new, RhoH);
+        // base state enthalpy was updated above along with rho0_new
 
         // compute intra_rhoh0 = (rhoh0_new - rhoh0_old)/dt 
         //                       - (rhoh0_hat - rhoh0_old)/dt
@@ -632,8 +638,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         gamma1bar_new.copy(gamma1bar_old);
     }
 
-    gamma1bar_nph.copy(0.5*(gamma1bar_old+gamma1bar_new));
-    beta0_nph.copy(0.5*(beta0_old + beta0_new));
+    gamma1bar_nph.lincomb(0.5, gamma1bar_old, 0.5, gamma1bar_new);
+    beta0_nph.lincomb(0.5, beta0_old, 0.5, beta0_new);
 
     //////////////////////////////////////////////////////////////////////////////
     // Corrector loop
@@ -793,7 +799,7 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         if (evolve_base_state) {
             MakeGravCell(grav_cell_new, rho0_new);
             
-            rho0_nph.copy(0.5*(rho0_old+rho0_new));
+            rho0_nph.lincomb(0.5, rho0_old, 0.5, rho0_new);
             
             MakeGravCell(grav_cell_nph, rho0_nph);
         } else {
@@ -809,7 +815,7 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
 
             EnforceHSE(rho0_new, p0_new, grav_cell_new);
             
-            p0_nph.copy(0.5*(p0_old + p0_new));
+            p0_nph.lincomb(0.5, p0_old, 0.5, p0_new);
             // p0_nph.copy(p0_new);
             
             // hold dp0/dt in psi for enthalpy advance
@@ -916,8 +922,12 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         FillPatch(0.5*(t_old+t_new), rhohalf, sold, snew, Rho, 0, 1, Rho, bcs_s);
 
         if (evolve_base_state) {
-            // update base state density and pressure
-            Average(snew, rho0_new, Rho);
+            // update base state density and pressure; snew is not modified
+            // again before rhoh0_new is needed, so average both in one sweep
+            {
+                Vector<BaseState<Real>*> phibar = {&rho0_new, &rhoh0_new};
+                Average(snew, phibar, {Rho, RhoH});
+            }
             ComputeCutoffCoords(rho0_new);
 
             if (use_etarho) {
@@ -939,8 +949,7 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
             // hold dp0/dt in psi for Make_S_cc
             psi.copy((p0_new - p0_old) / dt);
             
-            // also update base state enthalpy
-            Average(snew, rhoh0_new, RhoH);
+            // base state enthalpy was updated above along with rho0_new
             
             // compute intra_rhoh0 = (rhoh0_new - rhoh0_old)/dt 
             //                       - (rhoh0_hat - rhoh0_old)/dt
@@ -1038,8 +1047,8 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
             gamma1bar_new.copy(gamma1bar_old);
         }
 
-        gamma1bar_nph.copy(0.5*(gamma1bar_old+gamma1bar_new));
-        beta0_nph.copy(0.5*(beta0_old + beta0_new));
+        gamma1bar_nph.lincomb(0.5, gamma1bar_old, 0.5, gamma1bar_new);
+        beta0_nph.lincomb(0.5, beta0_old, 0.5, beta0_new);
         
     } // end loop over misdc iterations
     
@@ -1180,7 +1189,7 @@ Maestro::AdvanceTimeStepSDC (bool is_initIter) {
         FillPatch(t_new, unew, unew, unew, 0, 0, AMREX_SPACEDIM, 0, bcs_u, 1);
     }
 
-    beta0_nm1.copy(0.5*(beta0_old + beta0_new));
+    beta0_nm1.lincomb(0.5, beta0_old, 0.5, beta0_new);
 
     if (!is_initIter) {
         if (!fix_base_state) {
@@ -2,6 +2,7 @@
 #include <Maestro.H>
 #include <Maestro_F.H>
 #include <MaestroBCThreads.H>
+#include <MaestroScalUpdate.H>
 
 using namespace amrex;
 
@@ -115,6 +116,8 @@ Maestro::UpdateScal(const Vector<MultiFab>& stateold,
             const Array4<const Real> sfluxy = sflux[lev][1].array(mfi);
 #if (AMREX_SPACEDIM == 3)
             const Array4<const Real> sfluxz = sflux[lev][2].array(mfi);
+#else
+            const Array4<const Real> sfluxz;
 #endif
             const Array4<const Real> force_arr = force[lev].array(mfi);
             
@@ -123,89 +126,20 @@ Maestro::UpdateScal(const Vector<MultiFab>& stateold,
                 const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
 
                 AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
-                    Real divterm = ((sfluxx(i+1,j,k,RhoH) - sfluxx(i,j,k,RhoH))/dx[0]
-                        + (sfluxy(i,j+1,k,RhoH) - sfluxy(i,j,k,RhoH))/dx[1]
-#if (AMREX_SPACEDIM == 3)
-                        + (sfluxz(i,j,k+1,RhoH) - sfluxz(i,j,k,RhoH))/dx[2]
-#endif
-                        );
-             
-                    snew_arr(i,j,k,RhoH) = sold_arr(i,j,k,RhoH) 
-                        + dt_loc * (-divterm + force_arr(i,j,k,RhoH));
-
-                    if (do_eos_h_above_cutoff && snew_arr(i,j,k,Rho) <= base_cutoff_density) {
-                        eos_t eos_state;
-
-                        eos_state.rho = snew_arr(i,j,k,Rho);
-                        eos_state.T = sold_arr(i,j,k,Temp);
-                        eos_state.p = p0_arr(i,j,k);
-                        for (auto n = 0; n < NumSpec; ++n) {
-                            eos_state.xn[n] = snew_arr(i,j,k,FirstSpec+n) / eos_state.rho;
-                        }
-
-                        eos(eos_input_rp, eos_state);
-
-                        snew_arr(i,j,k,RhoH) = snew_arr(i,j,k,Rho) * eos_state.h;
-                    }
+                    UpdateRhoHCell(i, j, k, RhoH, sold_arr, snew_arr,
+                                   sfluxx, sfluxy, sfluxz, force_arr, p0_arr, dx, dt_loc);
                 });
 
             } else if (start_comp == FirstSpec) {   
                 // RhoX update
 
                 AMREX_PARALLEL_FOR_4D(tileBox, NumSpec, i, j, k, n, {
-                    int comp = FirstSpec + n;
-
-                    Real divterm = (sfluxx(i+1,j,k,comp) - sfluxx(i,j,k,comp))/dx[0];
-                    divterm += (sfluxy(i,j+1,k,comp) - sfluxy(i,j,k,comp))/dx[1];
-    #if (AMREX_SPACEDIM == 3)
-                    divterm += (sfluxz(i,j,k+1,comp) - sfluxz(i,j,k,comp))/dx[2];
-    #endif
-                    snew_arr(i,j,k,comp) = sold_arr(i,j,k,comp) 
-                        + dt_loc * (-divterm + force_arr(i,j,k,comp));
+                    UpdateRhoXCell(i, j, k, FirstSpec+n, sold_arr, snew_arr,
+                                   sfluxx, sfluxy, sfluxz, force_arr, dx, dt_loc);
                 });
 
                 AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
-                    // update density
-                    snew_arr(i,j,k,Rho) = sold_arr(i,j,k,Rho);
-
-                    bool has_negative_species = false;
-
-                    // define the update to rho as the sum of the updates to (rho X)_i
-                    for (int comp=start_comp; comp<start_comp+NumSpec; ++comp) {
-                        snew_arr(i,j,k,Rho) += snew_arr(i,j,k,comp)-sold_arr(i,j,k,comp);
-                        if (snew_arr(i,j,k,comp) < 0.0) 
-                            has_negative_species = true;
-                    }
-
-                    // enforce a density floor
-                    if (snew_arr(i,j,k,Rho) < 0.5*base_cutoff_density) {
-                        for (int comp=start_comp; comp<start_comp+NumSpec; ++comp) {
-                            snew_arr(i,j,k,comp) *= 0.5*base_cutoff_density/snew_arr(i,j,k,Rho);
-                        }
-                        snew_arr(i,j,k,Rho) = 0.5*base_cutoff_density;
-                    }
-
-                    // do not allow the species to leave here negative.
-                    if (has_negative_species) {
-                        for (int comp=start_comp; comp<start_comp+NumSpec; ++comp) {
-                            if (snew_arr(i,j,k,comp) < 0.0) {
-                                Real delta = -snew_arr(i,j,k,comp);
-                                Real sumX = 0.0;
-                                for (int comp2=start_comp; comp2<start_comp+NumSpec; ++comp2) {
-                                    if (comp2 != comp && snew_arr(i,j,k,comp2) >= 0.0) {
-                                        sumX += snew_arr(i,j,k,comp2);
-                                    }
-                                }
-                                for (int comp2 = start_comp; comp2 < start_comp+NumSpec; ++comp2) {
-                                    if (comp2 != comp && snew_arr(i,j,k,comp2) >= 0.0) {
-                                        Real frac = snew_arr(i,j,k,comp2) / sumX;
-                                        snew_arr(i,j,k,comp2) -= frac * delta;
-                                    }
-                                }
-                                snew_arr(i,j,k,comp) = 0.0;
-                            }
-                        }
-                    }
+                    UpdateRhoCell(i, j, k, sold_arr, snew_arr);
                 });
             } else {
                 Abort("Invalid scalar in UpdateScal().");
@@ -213,6 +147,15 @@ Maestro::UpdateScal(const Vector<MultiFab>& stateold,
         } // end MFIter loop
     } // end loop over levels
 
+    SyncScal(statenew, start_comp, num_comp);
+}
+
+void
+Maestro::SyncScal (Vector<MultiFab>& statenew, int start_comp, int num_comp)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SyncScal()", SyncScal);
+
     // synchronize by refluxing and averaging down, starting from the finest_level-1/finest_level pair
     if (reflux_type == 2) {
         for (int lev=finest_level-1; lev>=0; --lev) {
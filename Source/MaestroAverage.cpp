@@ -1,4 +1,3 @@
-
 #include <Maestro.H>
 #include <Maestro_F.H>
 
@@ -11,30 +10,53 @@ using namespace amrex;
 void Maestro::Average (const Vector<MultiFab>& phi,
                        BaseState<Real>& phibar,
                        int comp)
+{
+    Vector<BaseState<Real>*> phibar_vec = {&phibar};
+    Average(phi, phibar_vec, Vector<int>{comp});
+}
+
+// Average several components of phi in a single sweep over the hierarchy.
+// phibar[n] is filled with the average of component comps[n].  All
+// components share one pass over the data and one MPI reduction.
+
+void Maestro::Average (const Vector<MultiFab>& phi,
+                       const Vector<BaseState<Real>*>& phibar,
+                       const Vector<int>& comps)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::Average()", Average);
 
+    AMREX_ASSERT(phibar.size() == comps.size());
+
     const int max_lev = base_geom.max_radial_level+1;
     const auto nr_irreg = base_geom.nr_irreg;
-    
-    phibar.setVal(0.0);
+    const int ncomp = comps.size();
+
+    for (int n = 0; n < ncomp; ++n) {
+        phibar[n]->setVal(0.0);
+    }
+
+    // component indices accessible from within device kernels
+    IntVector comps_d(ncomp);
+    for (int n = 0; n < ncomp; ++n) {
+        comps_d[n] = comps[n];
+    }
+    const int* AMREX_RESTRICT comps_p = comps_d.dataPtr();
 
     if (!spherical) {
 
         // planar case
 
-        // phibar is dimensioned to "max_radial_level" so we must mimic that for phisum
-        // so we can simply swap this result with phibar
-        BaseState<Real> phisum(base_geom.max_radial_level+1, base_geom.nr_fine);
-        phisum.setVal(0.0);
-        auto phisum_arr = phisum.array();
+        // lateral sum at each height of every component,
+        // reduced over threads and ranks
+        BaseState<Real> phisum_s;
+        SumLateral(phi, comps, phisum_s);
+        const auto phisum = phisum_s.const_array();
 
         // this stores how many cells there are laterally at each level
         BaseState<int> ncell_s(base_geom.max_radial_level+1);
         auto ncell = ncell_s.array();
 
-        // loop is over the existing levels (up to finest_level)
         for (int lev=0; lev<=finest_level; ++lev) {
 
             // Get the index space of the domain
@@ -46,361 +68,594 @@ void Maestro::Average (const Vector<MultiFab>& phi,
             } else if (AMREX_SPACEDIM==3) {
                 ncell(lev) = (domainBox.bigEnd(0)+1)*(domainBox.bigEnd(1)+1);
             }
-        
-            // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#ifdef _OPENMP
-#pragma omp parallel if (!system::regtest_reduction)
-#endif
-            for ( MFIter mfi(phi[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi )
-            {
-                // Get the index space of the valid region
-                const Box& tilebox = mfi.tilebox();
+        }
 
-                const Array4<const Real> phi_arr = phi[lev].array(mfi, comp);
+        for (int n = 0; n < ncomp; ++n) {
 
-                AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
-                    int r = AMREX_SPACEDIM == 2 ? j : k;
-#if (AMREX_SPACEDIM == 2)
-                    if (k == 0)
-#endif
-                        amrex::HostDevice::Atomic::Add(&(phisum_arr(lev,r)), phi_arr(i, j, k));
-                });
-            }
-        }
-        
-        // reduction over boxes to get sum
-        ParallelDescriptor::ReduceRealSum(phisum.dataPtr(),(base_geom.max_radial_level+1)*base_geom.nr_fine);
-
-        // divide phisum by ncell so it stores "phibar"
-        for (int lev = 0; lev <= base_geom.max_radial_level; ++lev) {
-            for (auto i = 1; i <= base_geom.numdisjointchunks(lev); ++i) { 
-                const int lo = base_geom.r_start_coord(lev,i);
-                const int hi = base_geom.r_end_coord(lev,i);
-                AMREX_PARALLEL_FOR_1D(hi-lo+1, j, {
-                    int r = j + lo;
-                    phisum_arr(lev,r) /= ncell(lev);
-                });
-                Gpu::synchronize();
-            }
-        }
+            auto phibar_arr = phibar[n]->array();
 
-        RestrictBase(phisum, true);
-        FillGhostBase(phisum, true);
+            // divide phisum by ncell so it stores "phibar"
+            for (int lev = 0; lev <= base_geom.max_radial_level; ++lev) {
+                for (auto i = 1; i <= base_geom.numdisjointchunks(lev); ++i) { 
+                    const int lo = base_geom.r_start_coord(lev,i);
+                    const int hi = base_geom.r_end_coord(lev,i);
+                    AMREX_PARALLEL_FOR_1D(hi-lo+1, j, {
+                        int r = j + lo;
+                        phibar_arr(lev,r) = phisum(lev,r,n) / ncell(lev);
+                    });
+                    Gpu::synchronize();
+                }
+            }
 
-        // swap pointers so phibar contains the computed average
-        phisum.swap(phibar);
+            RestrictBase(*phibar[n], true);
+            FillGhostBase(*phibar[n], true);
+        }
 
     } else if (spherical && use_exact_base_state) {
         // spherical case with uneven base state spacing
 
         // phibar is dimensioned to "max_radial_level" so we must mimic that for phisum
-        // so we can simply swap this result with phibar
-        RealVector phisum((base_geom.max_radial_level+1)*base_geom.nr_fine,0.0);
+        BaseState<Real> phisum_s(max_lev, base_geom.nr_fine, ncomp);
+        phisum_s.setVal(0.0);
+        auto phisum = phisum_s.array();
 
         // this stores how many cells there are at each level
-        Vector<int> ncell((base_geom.max_radial_level+1)*base_geom.nr_fine,0);
+        BaseState<int> ncell_s(max_lev, base_geom.nr_fine);
+        ncell_s.setVal(0);
+        auto ncell = ncell_s.array();
 
         // loop is over the existing levels (up to finest_level)
         for (int lev=0; lev<=finest_level; ++lev) {
 
-            // get references to the MultiFabs at level lev
-            const MultiFab& phi_mf = phi[lev];
-            const iMultiFab& cc_to_r = cell_cc_to_r[lev];
-
             // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-            for (MFIter mfi(phi_mf); mfi.isValid(); ++mfi) {
+#ifdef _OPENMP
+#pragma omp parallel if (!system::regtest_reduction)
+#endif
+            for ( MFIter mfi(phi[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
 
                 // Get the index space of the valid region
-                const Box& validBox = mfi.validbox();
-
-                // call fortran subroutine
-                // use macros in AMReX_ArrayLim.H to pass in each FAB's data,
-                // lo/hi coordinates (including ghost cells), and/or the # of components
-                // We will also pass "validBox", which specifies the "valid" region.
-                average_sphr_irreg(&lev, ARLIM_3D(validBox.loVect()), ARLIM_3D(validBox.hiVect()),
-                                   BL_TO_FORTRAN_N_3D(phi_mf[mfi],comp),
-                                   phisum.dataPtr(), ncell.dataPtr(),
-                                   BL_TO_FORTRAN_3D(cc_to_r[mfi]));
+                const Box& tilebox = mfi.tilebox();
+
+                const Array4<const Real> phi_arr = phi[lev].array(mfi);
+                const Array4<const int> cc_to_r = cell_cc_to_r[lev].array(mfi);
+
+                AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
+                    const int index = cc_to_r(i,j,k);
+                    for (int n = 0; n < ncomp; ++n) {
+                        amrex::HostDevice::Atomic::Add(&(phisum(lev,index,n)), 
+                                                       phi_arr(i,j,k,comps_p[n]));
+                    }
+                    amrex::HostDevice::Atomic::Add(&(ncell(lev,index)), 1);
+                });
             }
         }
 
         // reduction over boxes to get sum
-        ParallelDescriptor::ReduceRealSum(phisum.dataPtr(),(base_geom.max_radial_level+1)*base_geom.nr_fine);
-        ParallelDescriptor::ReduceIntSum(ncell.dataPtr(),(base_geom.max_radial_level+1)*base_geom.nr_fine);
-
-        // divide phisum by ncell so it stores "phibar"
-        for (int lev = 0; lev < max_lev; ++lev) {
-            for (auto r = 0; r < base_geom.nr_fine; ++r) {
-                if (ncell[lev+max_lev*r] > 0) {
-                    phisum[lev+max_lev*r] /= ncell[lev+max_lev*r];
-                } else {
-                    // keep value constant if it is outside the cutoff coords
-                    phisum[lev+max_lev*r] = phisum[lev+max_lev*(r-1)];
+        ParallelDescriptor::ReduceRealSum(phisum_s.dataPtr(), max_lev*base_geom.nr_fine*ncomp);
+        ParallelDescriptor::ReduceIntSum(ncell_s.dataPtr(), max_lev*base_geom.nr_fine);
+
+        for (int n = 0; n < ncomp; ++n) {
+
+            auto phibar_arr = phibar[n]->array();
+
+            // divide phisum by ncell so it stores "phibar"
+            for (int lev = 0; lev < max_lev; ++lev) {
+                for (auto r = 0; r < base_geom.nr_fine; ++r) {
+                    if (ncell(lev,r) > 0) {
+                        phibar_arr(lev,r) = phisum(lev,r,n) / ncell(lev,r);
+                    } else if (r > 0) {
+                        // keep value constant if it is outside the cutoff coords
+                        phibar_arr(lev,r) = phibar_arr(lev,r-1);
+                    }
                 }
-            }           
-        }
+            }
 
-        BaseState<Real> phisum_b(phisum, base_geom.max_radial_level+1, base_geom.nr_fine);
-        RestrictBase(phisum_b, true);
-        FillGhostBase(phisum_b, true);
+            RestrictBase(*phibar[n], true);
+            FillGhostBase(*phibar[n], true);
+        }
 
-        // swap pointers so phibar contains the computed average
-        phisum_b.swap(phibar);
     } else {
         // spherical case with even base state spacing
 
+        // the bins, hit counts and interpolation stencils only change with
+        // the grids, so they are built once and reused until then
+        if (!spherical_averager.ok(phi, finest_level)) {
+            MakeSphericalAverager(phi);
+        }
+
         // For spherical, we construct a 1D array at each level, phisum, that has space
         // allocated for every possible radius that a cell-center at each level can
-        // map into.  The radial locations have been precomputed and stored in radii.
-        BaseState<Real> phisum_s(finest_level+1, nr_irreg+2);
+        // map into.  All components share the bins and the hit counts, ncell.
+        BaseState<Real> phisum_s(finest_level+1, nr_irreg+2, ncomp);
         auto phisum = phisum_s.array();
         phisum_s.setVal(0.0);
-        BaseState<Real> radii_s(finest_level+1, nr_irreg+3);
-        auto radii = radii_s.array();
-        BaseState<int> ncell_s(finest_level+1, nr_irreg+2);
-        auto ncell = ncell_s.array();
-        ncell_s.setVal(0);
-
-        const auto& center_p = center;
-
-        const int fine_lev = finest_level + 1;
-
-        // radii contains every possible distance that a cell-center at the finest
-        // level can map into
-        for (int lev=0; lev<=finest_level; ++lev) {
-
-            // Get the index space of the domain
-            const auto dx = geom[lev].CellSizeArray();
-
-            AMREX_PARALLEL_FOR_1D(nr_irreg+1, r, {
-                radii(lev,r+1) = std::sqrt(0.75+2.0*Real(r)) * dx[0];
-            });
-            Gpu::synchronize();
-
-            radii(lev,nr_irreg+2) = 1.e99;
-            radii(lev,0) = 0.0;
-        }
+        const auto ncell = spherical_averager.ncell.const_array();
 
         // loop is over the existing levels (up to finest_level)
         for (int lev=finest_level; lev>=0; --lev) {
 
-            // Get the grid size of the domain
-            const auto dx = geom[lev].CellSizeArray();
-            const auto prob_lo = geom[lev].ProbLoArray();
-
-            // get references to the MultiFabs at level lev
-            const MultiFab& phi_mf = phi[lev];
-
-            // create mask assuming refinement ratio = 2
-            int finelev = lev+1;
-            if (lev == finest_level) finelev = finest_level;
-
-            const BoxArray& fba = phi[finelev].boxArray();
-            const iMultiFab& mask = makeFineMask(phi_mf, fba, IntVect(2));
-
             // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel if (!system::regtest_reduction)
 #endif
-            for ( MFIter mfi(phi_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+            for ( MFIter mfi(phi[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
                 // Get the index space of the valid region
                 const Box& tilebox = mfi.tilebox();
 
-                const Array4<const int> mask_arr = mask.array(mfi);
-                const Array4<const Real> phi_arr = phi[lev].array(mfi, comp);
-
-                bool use_mask = !(lev==fine_lev-1);
+                const Array4<const int> bin_arr = spherical_averager.cell_bin[lev].array(mfi);
+                const Array4<const Real> phi_arr = phi[lev].array(mfi);
 
                 AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
-                    Real x = prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
-                    Real y = prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
-                    Real z = prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
-
-                    // make sure the cell isn't covered by finer cells
-                    bool cell_valid = true;
-                    if (use_mask) {
-                        if (mask_arr(i,j,k) == 1) cell_valid = false;
-                    }
-
-                    if (cell_valid) {
-                        // compute distance to center
-                        Real radius = sqrt(x*x + y*y + z*z);
-
-                        // figure out which radii index this point maps into
-                        int index = round(((radius/dx[0])*(radius/dx[0]) - 0.75) / 2.0);
-
-                        // due to roundoff error, need to ensure that we are in the proper radial bin
-                        if (index < nr_irreg) {
-                            if (fabs(radius-radii(lev,index+1)) > fabs(radius-radii(lev,index+2))) {
-                                index++;
-                            }
+                    // bin 0 means the cell is covered by finer cells
+                    const int bin = bin_arr(i,j,k);
+                    if (bin > 0) {
+                        for (int n = 0; n < ncomp; ++n) {
+                            amrex::HostDevice::Atomic::Add(&(phisum(lev,bin,n)), 
+                                                           phi_arr(i,j,k,comps_p[n]));
                         }
-
-                        amrex::HostDevice::Atomic::Add(&(phisum(lev,index+1)), phi_arr(i,j,k));
-                        amrex::HostDevice::Atomic::Add(&(ncell(lev,index+1)), 1);
                     }
                 });
             }
         }
 
         // reduction over boxes to get sum
-        ParallelDescriptor::ReduceRealSum(phisum.dataPtr(),(finest_level+1)*(nr_irreg+2));
-        ParallelDescriptor::ReduceIntSum(ncell.dataPtr(),(finest_level+1)*(nr_irreg+2));
+        ParallelDescriptor::ReduceRealSum(phisum.dataPtr(),(finest_level+1)*(nr_irreg+2)*ncomp);
 
         // normalize phisum so it actually stores the average at a radius
-        for (auto n = 0; n <= finest_level; ++n) {
+        for (auto l = 0; l <= finest_level; ++l) {
             for (auto r = 0; r <= nr_irreg; ++r) {
-                if (ncell(n,r+1) != 0) {
-                    phisum(n,r+1) /= Real(ncell(n,r+1));
+                if (ncell(l,r+1) != 0) {
+                    for (int n = 0; n < ncomp; ++n) {
+                        phisum(l,r+1,n) /= Real(ncell(l,r+1));
+                    }
                 }
             }
         }
 
-        BaseState<int> which_lev_s(base_geom.nr_fine);
-        auto which_lev = which_lev_s.array();
-        BaseState<int> max_rcoord_s(fine_lev);
-        auto max_rcoord = max_rcoord_s.array();
-
         // compute center point for the finest level
-        phisum(finest_level,0) = (11.0/8.0) * phisum(finest_level,1)
-            - (3.0/8.0) * phisum(finest_level,2);
-        ncell(finest_level,0) = 1;
+        for (int n = 0; n < ncomp; ++n) {
+            phisum(finest_level,0,n) = (11.0/8.0) * phisum(finest_level,1,n)
+                - (3.0/8.0) * phisum(finest_level,2,n);
+        }
 
-        // choose which level to interpolate from
+        // compute phibar for every component into a single scratch array by
+        // interpolating from the precomputed stencils
         const auto dr0 = base_geom.dr(0);
         const auto nrf = base_geom.nr_fine;
+        const auto which_lev = spherical_averager.which_lev.const_array();
+        const auto stencil_bin = spherical_averager.stencil_bin.const_array();
+        const auto stencil_radius = spherical_averager.stencil_radius.const_array();
+        const auto limit = spherical_averager.limit.const_array();
+
+        BaseState<Real> phibar_s(1, nrf, ncomp);
+        auto phibar_arr = phibar_s.array();
 
         AMREX_PARALLEL_FOR_1D(nrf, r, {
 
             Real radius = (Real(r) + 0.5) * dr0;
-            // Vector<int> rcoord_p(fine_lev, 0);
-            int rcoord_p[MAESTRO_MAX_LEVELS];
-
-            // initialize
-            for (int & coord : rcoord_p) {
-                coord = 0.0;
-            }
+            const int lev = which_lev(r);
 
-            // for each level, find the closest coordinate
-            for (auto n = 0; n < fine_lev; ++n) {
-                for (auto j = rcoord_p[n]; j <= nr_irreg; ++j) {
-                    if (fabs(radius-radii(n,j+1)) < fabs(radius-radii(n,j+2))) {
-                        rcoord_p[n] = j;
-                        break;
-                    }
+            for (int n = 0; n < ncomp; ++n) {
+                Real phi_s[3];
+                for (int m = 0; m < 3; ++m) {
+                    const int bin = stencil_bin(0,r,m);
+                    phi_s[m] = bin >= 0 ? phisum(lev,bin,n) : 1.e99;
                 }
+                phibar_arr(0,r,n) = QuadInterp(radius, 
+                        stencil_radius(0,r,0), 
+                        stencil_radius(0,r,1), 
+                        stencil_radius(0,r,2), 
+                        phi_s[0], phi_s[1], phi_s[2], limit(r));
             }
+        });
+        Gpu::synchronize();
 
-            // make sure closest coordinate is in bounds
-            for (auto n = 0; n < fine_lev-1; ++n) {
-                rcoord_p[n] = amrex::max(rcoord_p[n],1);
-            }
-            for (auto n = 0; n < fine_lev; ++n) {
-                rcoord_p[n] = amrex::min(rcoord_p[n],nr_irreg-1);
+        for (int n = 0; n < ncomp; ++n) {
+            auto phibar_n = phibar[n]->array();
+            for (auto r = 0; r < nrf; ++r) {
+                phibar_n(0,r) = phibar_arr(0,r,n);
             }
+        }
+    }
+}
+
+// Build the spherical_averager tables for the grids of phi (spherical,
+// evenly spaced base state only).  The radial bin of each cell, the hit
+// counts and the interpolation stencils depend only on the grid hierarchy,
+// so this is called from Average the first time it sees a new set of
+// grids or a new distribution mapping.
+void Maestro::MakeSphericalAverager (const Vector<MultiFab>& phi)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeSphericalAverager()", MakeSphericalAverager);
 
-            // choose the level with the largest min over the ncell interpolation points
-            which_lev(r) = 0;
+    const auto nr_irreg = base_geom.nr_irreg;
+    const int fine_lev = finest_level + 1;
 
-            int min_all = amrex::min(ncell(0,rcoord_p[0]), 
-                ncell(0,rcoord_p[0]+1), 
-                ncell(0,rcoord_p[0]+2));
+    SphericalAverager& avg = spherical_averager;
 
-            for (auto n = 1; n < fine_lev; ++n) {
-                int min_lev = amrex::min(ncell(n,rcoord_p[n]), 
-                    ncell(n,rcoord_p[n]+1), 
-                    ncell(n,rcoord_p[n]+2));
+    // radii contains every possible distance that a cell-center at the finest
+    // level can map into
+    BaseState<Real> radii_s(finest_level+1, nr_irreg+3);
+    auto radii = radii_s.array();
 
-                if (min_lev > min_all) {
-                    min_all = min_lev;
-                    which_lev(r) = n;
-                }
-            }
+    for (int lev=0; lev<=finest_level; ++lev) {
 
-            // if the min hit count at all levels is zero, we expand the search
-            // to find the closest instance of where the hitcount becomes nonzero
-            int j = 1;
-            while (min_all == 0) {
-                j++;
-                for (auto n = 0; n < fine_lev; ++n) {
-                    int min_lev = amrex::max(ncell(n,amrex::max(1,rcoord_p[n]-j)+1), 
-                        ncell(n,amrex::min(rcoord_p[n]+j,nr_irreg-1)+1));
-                    if (min_lev != 0) {
-                        which_lev(r) = n;
-                        min_all = min_lev;
-                        break;
-                    }
-                }
-            }
+        // Get the index space of the domain
+        const auto dx = geom[lev].CellSizeArray();
+
+        AMREX_PARALLEL_FOR_1D(nr_irreg+1, r, {
+            radii(lev,r+1) = std::sqrt(0.75+2.0*Real(r)) * dx[0];
         });
         Gpu::synchronize();
 
-        // squish the list at each level down to exclude points with no contribution
-        for (auto n = 0; n <= finest_level; ++n) {
-            int j = 0;
-            for (auto r = 0; r <= nr_irreg; ++r) {
-                while (ncell(n,j+1) == 0) {
-                    j++;
-                    if (j > nr_irreg) {
-                        break;
-                    }
+        radii(lev,nr_irreg+2) = 1.e99;
+        radii(lev,0) = 0.0;
+    }
+
+    avg.ncell.define(finest_level+1, nr_irreg+2);
+    avg.ncell.setVal(0);
+    auto ncell = avg.ncell.array();
+
+    const auto& center_p = center;
+
+    avg.cell_bin.resize(finest_level+1);
+
+    // loop is over the existing levels (up to finest_level)
+    for (int lev=finest_level; lev>=0; --lev) {
+
+        // Get the grid size of the domain
+        const auto dx = geom[lev].CellSizeArray();
+        const auto prob_lo = geom[lev].ProbLoArray();
+
+        // get references to the MultiFabs at level lev
+        const MultiFab& phi_mf = phi[lev];
+
+        avg.cell_bin[lev].define(phi_mf.boxArray(), phi_mf.DistributionMap(), 1, 0);
+
+        // create mask assuming refinement ratio = 2
+        int finelev = lev+1;
+        if (lev == finest_level) finelev = finest_level;
+
+        const BoxArray& fba = phi[finelev].boxArray();
+        const iMultiFab& mask = makeFineMask(phi_mf, fba, IntVect(2));
+
+        // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel if (!system::regtest_reduction)
+#endif
+        for ( MFIter mfi(phi_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+            // Get the index space of the valid region
+            const Box& tilebox = mfi.tilebox();
+
+            const Array4<const int> mask_arr = mask.array(mfi);
+            const Array4<int> bin_arr = avg.cell_bin[lev].array(mfi);
+
+            bool use_mask = !(lev==fine_lev-1);
+
+            AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
+                Real x = prob_lo[0] + (Real(i) + 0.5) * dx[0] - center_p[0];
+                Real y = prob_lo[1] + (Real(j) + 0.5) * dx[1] - center_p[1];
+                Real z = prob_lo[2] + (Real(k) + 0.5) * dx[2] - center_p[2];
+
+                // make sure the cell isn't covered by finer cells
+                bool cell_valid = true;
+                if (use_mask) {
+                    if (mask_arr(i,j,k) == 1) cell_valid = false;
                 }
-                if (j > nr_irreg) {
-                    for (auto i = r; i <= nr_irreg; ++i) {
-                        phisum(n,i+1) = 1.e99;
-                    }
-                    for (auto i = r; i <= nr_irreg+1; ++i) {
-                        radii(n,i+1) = 1.e99;
+
+                bin_arr(i,j,k) = 0;
+
+                if (cell_valid) {
+                    // compute distance to center
+                    Real radius = sqrt(x*x + y*y + z*z);
+
+                    // figure out which radii index this point maps into
+                    int index = round(((radius/dx[0])*(radius/dx[0]) - 0.75) / 2.0);
+
+                    // due to roundoff error, need to ensure that we are in the proper radial bin
+                    if (index < nr_irreg) {
+                        if (fabs(radius-radii(lev,index+1)) > fabs(radius-radii(lev,index+2))) {
+                            index++;
+                        }
                     }
-                    max_rcoord(n) = r - 1;
+
+                    bin_arr(i,j,k) = index+1;
+                    amrex::HostDevice::Atomic::Add(&(ncell(lev,index+1)), 1);
+                }
+            });
+        }
+    }
+
+    // reduction over boxes to get the hit counts
+    ParallelDescriptor::ReduceIntSum(ncell.dataPtr(),(finest_level+1)*(nr_irreg+2));
+
+    // the finest level also has an extrapolated center point
+    ncell(finest_level,0) = 1;
+
+    avg.which_lev.define(base_geom.nr_fine);
+    auto which_lev = avg.which_lev.array();
+    BaseState<int> max_rcoord_s(fine_lev);
+    auto max_rcoord = max_rcoord_s.array();
+
+    // choose which level to interpolate from
+    const auto dr0 = base_geom.dr(0);
+    const auto nrf = base_geom.nr_fine;
+
+    AMREX_PARALLEL_FOR_1D(nrf, r, {
+
+        Real radius = (Real(r) + 0.5) * dr0;
+        // Vector<int> rcoord_p(fine_lev, 0);
+        int rcoord_p[MAESTRO_MAX_LEVELS];
+
+        // initialize
+        for (int & coord : rcoord_p) {
+            coord = 0.0;
+        }
+
+        // for each level, find the closest coordinate
+        for (auto n = 0; n < fine_lev; ++n) {
+            for (auto j = rcoord_p[n]; j <= nr_irreg; ++j) {
+                if (fabs(radius-radii(n,j+1)) < fabs(radius-radii(n,j+2))) {
+                    rcoord_p[n] = j;
+                    break;
+                }
+            }
+        }
+
+        // make sure closest coordinate is in bounds
+        for (auto n = 0; n < fine_lev-1; ++n) {
+            rcoord_p[n] = amrex::max(rcoord_p[n],1);
+        }
+        for (auto n = 0; n < fine_lev; ++n) {
+            rcoord_p[n] = amrex::min(rcoord_p[n],nr_irreg-1);
+        }
+
+        // choose the level with the largest min over the ncell interpolation points
+        which_lev(r) = 0;
+
+        int min_all = amrex::min(ncell(0,rcoord_p[0]), 
+            ncell(0,rcoord_p[0]+1), 
+            ncell(0,rcoord_p[0]+2));
+
+        for (auto n = 1; n < fine_lev; ++n) {
+            int min_lev = amrex::min(ncell(n,rcoord_p[n]), 
+                ncell(n,rcoord_p[n]+1), 
+                ncell(n,rcoord_p[n]+2));
+
+            if (min_lev > min_all) {
+                min_all = min_lev;
+                which_lev(r) = n;
+            }
+        }
+
+        // if the min hit count at all levels is zero, we expand the search
+        // to find the closest instance of where the hitcount becomes nonzero
+        int j = 1;
+        while (min_all == 0) {
+            j++;
+            for (auto n = 0; n < fine_lev; ++n) {
+                int min_lev = amrex::max(ncell(n,amrex::max(1,rcoord_p[n]-j)+1), 
+                    ncell(n,amrex::min(rcoord_p[n]+j,nr_irreg-1)+1));
+                if (min_lev != 0) {
+                    which_lev(r) = n;
+                    min_all = min_lev;
                     break;
                 }
-                phisum(n,r+1) = phisum(n,j+1);
-                radii(n,r+1) = radii(n,j+1);
-                ncell(n,r+1) = ncell(n,j+1);
+            }
+        }
+    });
+    Gpu::synchronize();
+
+    // squish the list at each level down to exclude points with no
+    // contribution.  bin(l,r) records which bin of phisum ends up in
+    // position r of the squished list, or -1 where it is past the end
+    BaseState<int> bin_s(finest_level+1, nr_irreg+3);
+    auto bin = bin_s.array();
+    BaseState<int> hits_s(avg.ncell);
+    auto hits = hits_s.array();
+
+    for (auto l = 0; l <= finest_level; ++l) {
+        for (auto r = 0; r < nr_irreg+2; ++r) {
+            bin(l,r) = r;
+        }
+        bin(l,nr_irreg+2) = -1;
+
+        int j = 0;
+        for (auto r = 0; r <= nr_irreg; ++r) {
+            while (hits(l,j+1) == 0) {
                 j++;
                 if (j > nr_irreg) {
-                    max_rcoord(n) = r;
                     break;
                 }
             }
+            if (j > nr_irreg) {
+                for (auto i = r; i <= nr_irreg; ++i) {
+                    bin(l,i+1) = -1;
+                }
+                for (auto i = r; i <= nr_irreg+1; ++i) {
+                    radii(l,i+1) = 1.e99;
+                }
+                max_rcoord(l) = r - 1;
+                break;
+            }
+            bin(l,r+1) = bin(l,j+1);
+            radii(l,r+1) = radii(l,j+1);
+            hits(l,r+1) = hits(l,j+1);
+            j++;
+            if (j > nr_irreg) {
+                max_rcoord(l) = r;
+                break;
+            }
         }
+    }
 
-        // compute phibar
-        const Real drdxfac_loc = drdxfac;
-        auto phibar_arr = phibar.array();
+    // the interpolation stencil at each base state radius
+    const Real drdxfac_loc = drdxfac;
 
-        AMREX_PARALLEL_FOR_1D(nrf, r, {
+    avg.stencil_bin.define(1, nrf, 3);
+    avg.stencil_radius.define(1, nrf, 3);
+    avg.limit.define(nrf);
+    auto stencil_bin = avg.stencil_bin.array();
+    auto stencil_radius = avg.stencil_radius.array();
+    auto limit = avg.limit.array();
 
-            Real radius = (Real(r) + 0.5) * dr0;
-            int stencil_coord = 0;
+    AMREX_PARALLEL_FOR_1D(nrf, r, {
 
-            // find the closest coordinate
-            for (auto j = stencil_coord; j <= max_rcoord(which_lev(r)); ++j) {
-                if (fabs(radius-radii(which_lev(r),j+1)) < 
-                    fabs(radius-radii(which_lev(r),j+2))) {
-                    stencil_coord = j;
-                    break;
-                }
+        Real radius = (Real(r) + 0.5) * dr0;
+        int stencil_coord = 0;
+
+        // find the closest coordinate
+        for (auto j = stencil_coord; j <= max_rcoord(which_lev(r)); ++j) {
+            if (fabs(radius-radii(which_lev(r),j+1)) < 
+                fabs(radius-radii(which_lev(r),j+2))) {
+                stencil_coord = j;
+                break;
             }
+        }
 
-            // make sure the interpolation points will be in bounds
-            if (which_lev(r) != fine_lev-1) {
-                stencil_coord = amrex::max(stencil_coord, 1);
+        // make sure the interpolation points will be in bounds
+        if (which_lev(r) != fine_lev-1) {
+            stencil_coord = amrex::max(stencil_coord, 1);
+        }
+        stencil_coord = amrex::min(stencil_coord, 
+                max_rcoord(which_lev(r))-1);
+
+        limit(r) = (r <= nrf - 1 - drdxfac_loc*pow(2.0, (fine_lev-2)));
+
+        for (int m = 0; m < 3; ++m) {
+            stencil_bin(0,r,m) = bin(which_lev(r),stencil_coord+m);
+            stencil_radius(0,r,m) = radii(which_lev(r),stencil_coord+m);
+        }
+    });
+    Gpu::synchronize();
+}
+
+// Compute the lateral sum of phi at each height for every component in comps
+// (planar geometry only).  On exit phisum(lev,r,n) holds the sum of component
+// comps[n] over all cells at height r on level lev, summed over all ranks.
+//
+// On the CPU each OpenMP thread accumulates its tiles into a private radial
+// buffer, so there is no contention on the nr_fine slots.  The thread buffers
+// are then combined pairwise in a tree and all components are reduced across
+// ranks with a single ReduceRealSum.
+void Maestro::SumLateral (const Vector<MultiFab>& phi,
+                          const Vector<int>& comps,
+                          BaseState<Real>& phisum)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SumLateral()", SumLateral);
+
+    const int nlev = base_geom.max_radial_level+1;
+    const int nr_fine = base_geom.nr_fine;
+    const int ncomp = comps.size();
+    const int nsum = nlev*nr_fine*ncomp;
+
+    // components are stored innermost so a single reduction covers all of them
+    phisum.define(nlev, nr_fine, ncomp);
+
+    if (Gpu::inLaunchRegion()) {
+
+        auto phisum_arr = phisum.array();
+
+        // loop is over the existing levels (up to finest_level)
+        for (int lev=0; lev<=finest_level; ++lev) {
+            for ( MFIter mfi(phi[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi )
+            {
+                // Get the index space of the valid region
+                const Box& tilebox = mfi.tilebox();
+
+                for (int n = 0; n < ncomp; ++n) {
+                    const Array4<const Real> phi_arr = phi[lev].array(mfi, comps[n]);
+
+                    AMREX_PARALLEL_FOR_3D(tilebox, i, j, k, {
+                        int r = AMREX_SPACEDIM == 2 ? j : k;
+#if (AMREX_SPACEDIM == 2)
+                        if (k == 0)
+#endif
+                            amrex::HostDevice::Atomic::Add(&(phisum_arr(lev,r,n)), phi_arr(i,j,k));
+                    });
+                }
             }
-            stencil_coord = amrex::min(stencil_coord, 
-                    max_rcoord(which_lev(r))-1);
-
-            bool limit = (r <= nrf - 1 - drdxfac_loc*pow(2.0, (fine_lev-2)));
-
-            phibar_arr(0,r) = QuadInterp(radius, 
-                    radii(which_lev(r),stencil_coord), 
-                    radii(which_lev(r),stencil_coord+1), 
-                    radii(which_lev(r),stencil_coord+2), 
-                    phisum(which_lev(r),stencil_coord), 
-                    phisum(which_lev(r),stencil_coord+1), 
-                    phisum(which_lev(r),stencil_coord+2), limit);
-        });
+        }
         Gpu::synchronize();
+
+    } else {
+
+#ifdef _OPENMP
+        const int nthreads = system::regtest_reduction ? 1 : omp_get_max_threads();
+#else
+        const int nthreads = 1;
+#endif
+
+        // one private radial buffer per thread
+        Vector<Real> thread_sum(nthreads*nsum, 0.0);
+
+        // loop is over the existing levels (up to finest_level)
+        for (int lev=0; lev<=finest_level; ++lev) {
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+            {
+#ifdef _OPENMP
+                Real* AMREX_RESTRICT my_sum = thread_sum.dataPtr() + omp_get_thread_num()*nsum;
+#else
+                Real* AMREX_RESTRICT my_sum = thread_sum.dataPtr();
+#endif
+                for ( MFIter mfi(phi[lev], true); mfi.isValid(); ++mfi )
+                {
+                    // Get the index space of the valid region
+                    const Box& tilebox = mfi.tilebox();
+                    const auto lo = amrex::lbound(tilebox);
+                    const auto hi = amrex::ubound(tilebox);
+
+                    for (int n = 0; n < ncomp; ++n) {
+                        const Array4<const Real> phi_arr = phi[lev].array(mfi, comps[n]);
+
+                        // sum each row in a register, then do one store per height
+#if (AMREX_SPACEDIM == 2)
+                        for (int j = lo.y; j <= hi.y; ++j) {
+                            Real rowsum = 0.0;
+                            for (int i = lo.x; i <= hi.x; ++i) {
+                                rowsum += phi_arr(i,j,0);
+                            }
+                            my_sum[(lev*nr_fine + j)*ncomp + n] += rowsum;
+                        }
+#else
+                        for (int k = lo.z; k <= hi.z; ++k) {
+                            Real planesum = 0.0;
+                            for (int j = lo.y; j <= hi.y; ++j) {
+                                for (int i = lo.x; i <= hi.x; ++i) {
+                                    planesum += phi_arr(i,j,k);
+                                }
+                            }
+                            my_sum[(lev*nr_fine + k)*ncomp + n] += planesum;
+                        }
+#endif
+                    }
+                }
+            }
+        }
+
+        // combine the thread buffers pairwise in a tree; after the last pass
+        // buffer 0 holds the sum over all threads
+        for (int stride = 1; stride < nthreads; stride *= 2) {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (int t = 0; t < nthreads-stride; t += 2*stride) {
+                Real* AMREX_RESTRICT dst = thread_sum.dataPtr() + t*nsum;
+                const Real* AMREX_RESTRICT src = thread_sum.dataPtr() + (t+stride)*nsum;
+                for (int i = 0; i < nsum; ++i) {
+                    dst[i] += src[i];
+                }
+            }
+        }
+
+        std::copy(thread_sum.begin(), thread_sum.begin()+nsum, phisum.dataPtr());
     }
-}
\ No newline at end of file
+
+    // reduction over boxes to get sum
+    ParallelDescriptor::ReduceRealSum(phisum.dataPtr(), nsum);
+}
@@ -112,9 +112,12 @@ Maestro::InitBaseState(BaseState<Real>& rho0, BaseState<Real>& rhoh0,
 
         } else {
 
-            Real d_ambient = input_model.Interpolate(rloc, input_model.idens_model);
-            Real t_ambient = input_model.Interpolate(rloc, input_model.itemp_model);
-            Real p_ambient = input_model.Interpolate(rloc, input_model.ipres_model);
+            Real model_vars[ModelParser::nvars_model];
+            input_model.InterpolateAll(rloc, model_vars);
+
+            Real d_ambient = model_vars[input_model.idens_model];
+            Real t_ambient = model_vars[input_model.itemp_model];
+            Real p_ambient = model_vars[input_model.ipres_model];
 
             RealVector xn_ambient(NumSpec);
 
@@ -122,7 +125,7 @@ Maestro::InitBaseState(BaseState<Real>& rho0, BaseState<Real>& rhoh0,
 
             for (auto comp = 0; comp < NumSpec; ++comp) {
                 xn_ambient[comp] = max(0.0, min(1.0, 
-                    input_model.Interpolate(rloc, input_model.ispec_model+comp)));
+                    model_vars[input_model.ispec_model+comp]));
                 sumX += xn_ambient[comp];
             }
 
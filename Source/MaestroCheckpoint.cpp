@@ -1,6 +1,9 @@
 
+#include <algorithm>
+#include <cstdio>
 #include <Maestro.H>
 #include <AMReX_VisMF.H>
+#include <AMReX_Utility.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
@@ -8,6 +11,217 @@ using namespace amrex;
 namespace
 {
     const std::string level_prefix {"Level_"};
+
+    // write the base state files; the cell-centered data has 11 values
+    // per radial index and the face-centered data has 2
+    bool WriteBaseState (const std::string& checkpointname,
+                         const Vector<Real>& base_cc,
+                         const Vector<Real>& base_fc)
+    {
+        VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+
+        // write out the cell-centered base state
+        std::ofstream BaseCCFile;
+        BaseCCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+        std::string BaseCCFileName(checkpointname + "/BaseCC");
+        BaseCCFile.open(BaseCCFileName.c_str(), std::ofstream::out   |
+                        std::ofstream::trunc |
+                        std::ofstream::binary);
+        if( !BaseCCFile.good()) {
+            return false;
+        }
+
+        BaseCCFile.precision(17);
+
+        for (int i=0; i<base_cc.size(); i+=11) {
+            for (int n=0; n<10; ++n) {
+                BaseCCFile << base_cc[i+n] << " ";
+            }
+            BaseCCFile << base_cc[i+10] << "\n";
+        }
+        BaseCCFile.close();
+
+        // write out the face-centered base state
+        std::ofstream BaseFCFile;
+        BaseFCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+        std::string BaseFCFileName(checkpointname + "/BaseFC");
+        BaseFCFile.open(BaseFCFileName.c_str(), std::ofstream::out   |
+                        std::ofstream::trunc |
+                        std::ofstream::binary);
+        if( !BaseFCFile.good()) {
+            return false;
+        }
+
+        BaseFCFile.precision(17);
+
+        for (int i=0; i<base_fc.size(); i+=2) {
+            BaseFCFile << base_fc[i] << " "
+                       << base_fc[i+1] << "\n";
+        }
+        BaseFCFile.close();
+
+        return !BaseCCFile.fail() && !BaseFCFile.fail();
+    }
+
+    // file names used by the asynchronous checkpoint format.  As with
+    // VisMF, the processors share min(VisMF::GetNOutFiles(), nprocs) data
+    // files, <prefix>_D_<file>, processor p writing to file p % nfiles.
+    // <prefix>_I_<file> is an index of the (grid, offset) pairs in a file.
+    std::string AsyncDataFile (const std::string& prefix, int file)
+    {
+        return amrex::Concatenate(prefix + "_D_", file, 5);
+    }
+
+    std::string AsyncIndexFile (const std::string& prefix, int file)
+    {
+        return amrex::Concatenate(prefix + "_I_", file, 5);
+    }
+
+    int AsyncNFiles ()
+    {
+        return std::max(1, std::min(VisMF::GetNOutFiles(), ParallelDescriptor::NProcs()));
+    }
+
+    // create the data file that processor myproc is the first to write
+    // to, which the writer threads then fill in place
+    void CreateSharedFabFile (const std::string& prefix, int nfiles)
+    {
+        const int myproc = ParallelDescriptor::MyProc();
+        if (myproc >= nfiles) {
+            return;
+        }
+
+        std::ofstream DataFile(AsyncDataFile(prefix, myproc).c_str(),
+                               std::ofstream::out   |
+                               std::ofstream::trunc |
+                               std::ofstream::binary);
+        if (!DataFile.good()) {
+            amrex::FileOpenFailed(AsyncDataFile(prefix, myproc));
+        }
+    }
+
+    // write the locally owned fabs of mf, each a FAB header followed by
+    // its data, to the data file created by CreateSharedFabFile.  Within
+    // a file the processors lay out their fabs one after the other in
+    // rank order.  Every fab's size follows from the BoxArray and the
+    // DistributionMapping, so each processor finds its offsets without
+    // any communication and this is safe to call from the background
+    // writer thread.
+    bool WriteLocalFabs (const MultiFab& mf, const std::string& prefix, int nfiles)
+    {
+        const int myproc = ParallelDescriptor::MyProc();
+        const int nprocs = ParallelDescriptor::NProcs();
+        const int myfile = myproc % nfiles;
+        const int ncomp = mf.nComp();
+        const DistributionMapping& dm = mf.DistributionMap();
+
+        Vector<Vector<int> > proc_grids(nprocs);
+        for (int k = 0; k < mf.size(); ++k) {
+            proc_grids[dm[k]].push_back(k);
+        }
+
+        Vector<std::string> headers(mf.size());
+        Vector<long> offset(mf.size(), -1);
+        Vector<long> file_bytes(nfiles, 0);
+        for (int p = 0; p < nprocs; ++p) {
+            for (const int k : proc_grids[p]) {
+                const Box& bx = mf.fabbox(k);
+
+                std::ostringstream header;
+                FArrayBox fab(bx, 1);
+                FArrayBox::getFABio().write_header(header, fab, ncomp);
+                headers[k] = header.str();
+
+                offset[k] = file_bytes[p % nfiles];
+                file_bytes[p % nfiles] += headers[k].size() + long(bx.numPts())*ncomp*sizeof(Real);
+            }
+        }
+
+        bool ok = true;
+
+        // the first processor of each file writes its index
+        if (myproc < nfiles) {
+            std::ofstream IndexFile(AsyncIndexFile(prefix, myfile).c_str(),
+                                    std::ofstream::out |
+                                    std::ofstream::trunc);
+            if (!IndexFile.good()) {
+                return false;
+            }
+            for (int p = myfile; p < nprocs; p += nfiles) {
+                for (const int k : proc_grids[p]) {
+                    IndexFile << k << " " << offset[k] << "\n";
+                }
+            }
+            IndexFile.close();
+            ok = !IndexFile.fail();
+        }
+
+        if (proc_grids[myproc].empty()) {
+            return ok;
+        }
+
+        std::fstream DataFile(AsyncDataFile(prefix, myfile).c_str(),
+                              std::ios::in  |
+                              std::ios::out |
+                              std::ios::binary);
+        if (!DataFile.good()) {
+            return false;
+        }
+
+        for (const int k : proc_grids[myproc]) {
+            const FArrayBox& fab = mf[k];
+            DataFile.seekp(offset[k], std::ios::beg);
+            DataFile << headers[k];
+            DataFile.write(reinterpret_cast<const char*>(fab.dataPtr()),
+                           long(fab.box().numPts())*ncomp*sizeof(Real));
+        }
+        DataFile.close();
+
+        return ok && !DataFile.fail();
+    }
+
+    // read a MultiFab written by WriteLocalFabs to nfiles data files into
+    // mf, which may have a different distribution mapping
+    void ReadLocalFabs (MultiFab& mf, const std::string& prefix, int nfiles)
+    {
+        Vector<int> file_num(mf.size(), -1);
+        Vector<long> file_offset(mf.size(), -1);
+
+        for (int f = 0; f < nfiles; ++f) {
+            Vector<char> fileCharPtr;
+            ParallelDescriptor::ReadAndBcastFile(AsyncIndexFile(prefix, f), fileCharPtr);
+            std::string fileCharPtrString(fileCharPtr.dataPtr());
+            std::istringstream is(fileCharPtrString, std::istringstream::in);
+
+            int k;
+            long offset;
+            while (is >> k >> offset) {
+                file_num[k] = f;
+                file_offset[k] = offset;
+            }
+        }
+
+        for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            const int k = mfi.index();
+            if (file_num[k] < 0) {
+                Abort("ReadLocalFabs: no data for grid " + std::to_string(k)
+                      + " in " + prefix);
+            }
+
+            std::ifstream DataFile(AsyncDataFile(prefix, file_num[k]).c_str(),
+                                   std::ifstream::in | std::ifstream::binary);
+            if (!DataFile.good()) {
+                amrex::FileOpenFailed(AsyncDataFile(prefix, file_num[k]));
+            }
+            DataFile.seekg(file_offset[k], std::ios::beg);
+
+            FArrayBox fab;
+            fab.readFrom(DataFile);
+
+            const Box bx = fab.box() & mfi.fabbox();
+            mf[mfi].copy<RunOn::Device>(fab, bx, 0, bx, 0, mf.nComp());
+        }
+    }
 }
 
 // compute S at cell-centers
@@ -20,12 +234,22 @@ Maestro::WriteCheckPoint (int step) {
     // chk00010/Level_0/
     // chk00010/Level_1/
     // etc.                these subdirectories will hold the MultiFab data at each level of refinement
+    //
+    // with async_checkpoint, everything is written to chk00010.temp and the
+    // directory is renamed to chk00010 by FinishCheckPoint once every
+    // processor is done, so a partially written checkpoint is never picked
+    // up on restart
 
     // timer for profiling
     BL_PROFILE_VAR("Maestro::WriteCheckPoint()",WriteCheckPoint);
 
+    // only one asynchronous checkpoint is in flight at a time
+    FinishCheckPoint();
+
     // checkpoint file name, e.g., chk00010
-    const std::string& checkpointname = amrex::Concatenate(check_base_name,step,7);
+    const std::string& checkpointname = async_checkpoint ?
+        amrex::Concatenate(check_base_name,step,7) + ".temp" :
+        amrex::Concatenate(check_base_name,step,7);
 
     amrex::Print() << "Writing checkpoint " << checkpointname << "\n";
 
@@ -95,78 +319,173 @@ Maestro::WriteCheckPoint (int step) {
             CPUFile << std::setprecision(15) << getCPUTime();
             CPUFile.close();
         }
+
+        if (async_checkpoint) {
+            // mark the MultiFab data as being in the shared file format
+            // and record how many data files each MultiFab has
+            std::ofstream AsyncFile;
+            std::string AsyncFileName(checkpointname + "/AsyncFabs");
+            AsyncFile.open(AsyncFileName.c_str(), std::ios::out);
+            if( !AsyncFile.good()) {
+                amrex::FileOpenFailed(AsyncFileName);
+            }
+
+            AsyncFile << AsyncNFiles() << "\n";
+            AsyncFile.close();
+        }
     }
 
-    // write the MultiFab data to, e.g., chk00010/Level_0/
+    // the MultiFabs to write at each level, e.g., to chk00010/Level_0/
+    Vector<const MultiFab*> chk_mf;
+    Vector<std::string> chk_prefix;
     for (int lev = 0; lev <= finest_level; ++lev) {
-        VisMF::Write(snew[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "snew"));
-        VisMF::Write(unew[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "unew"));
-        VisMF::Write(gpi[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "gpi"));
-        VisMF::Write(dSdt[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "dSdt"));
-        VisMF::Write(S_cc_new[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "S_cc_new"));
+        chk_mf.push_back(&snew[lev]);
+        chk_prefix.push_back(amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "snew"));
+        chk_mf.push_back(&unew[lev]);
+        chk_prefix.push_back(amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "unew"));
+        chk_mf.push_back(&gpi[lev]);
+        chk_prefix.push_back(amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "gpi"));
+        chk_mf.push_back(&dSdt[lev]);
+        chk_prefix.push_back(amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "dSdt"));
+        chk_mf.push_back(&S_cc_new[lev]);
+        chk_prefix.push_back(amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "S_cc_new"));
 #ifdef SDC
-        VisMF::Write(intra[lev],
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "intra"));
+        chk_mf.push_back(&intra[lev]);
+        chk_prefix.push_back(amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "intra"));
 #endif
     }
 
-    // write out the cell-centered base state
+    // gather the base state on the IO processor
+    Vector<Real> base_cc;
+    Vector<Real> base_fc;
     if (ParallelDescriptor::IOProcessor()) {
+        for (int i=0; i<(base_geom.max_radial_level+1)*base_geom.nr_fine; ++i) {
+            base_cc.push_back(rho0_new.array()(i));
+            base_cc.push_back(p0_new.array()(i));
+            base_cc.push_back(gamma1bar_new.array()(i));
+            base_cc.push_back(rhoh0_new.array()(i));
+            base_cc.push_back(beta0_new.array()(i));
+            base_cc.push_back(psi.array()(i));
+            base_cc.push_back(tempbar.array()(i));
+            base_cc.push_back(etarho_cc.array()(i));
+            base_cc.push_back(tempbar_init.array()(i));
+            base_cc.push_back(p0_old.array()(i));
+            base_cc.push_back(beta0_nm1.array()(i));
+        }
 
-        std::ofstream BaseCCFile;
-        BaseCCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string BaseCCFileName(checkpointname + "/BaseCC");
-        BaseCCFile.open(BaseCCFileName.c_str(), std::ofstream::out   |
-                        std::ofstream::trunc |
-                        std::ofstream::binary);
-        if( !BaseCCFile.good()) {
-            amrex::FileOpenFailed(BaseCCFileName);
+        for (int i=0; i<(base_geom.max_radial_level+1)*(base_geom.nr_fine+1); ++i) {
+            base_fc.push_back(w0.array()(i));
+            base_fc.push_back(etarho_ec.array()(i));
         }
+    }
 
-        BaseCCFile.precision(17);
+    WriteJobInfo(checkpointname);
 
-        for (int i=0; i<(base_geom.max_radial_level+1)*base_geom.nr_fine; ++i) {
-            BaseCCFile << rho0_new.array()(i) << " "
-                       << p0_new.array()(i) << " "
-                       << gamma1bar_new.array()(i) << " "
-                       << rhoh0_new.array()(i) << " "
-                       << beta0_new.array()(i) << " "
-                       << psi.array()(i) << " "
-                       << tempbar.array()(i) << " "
-                       << etarho_cc.array()(i) << " "
-                       << tempbar_init.array()(i) << " "
-                       << p0_old.array()(i) << " "
-                       << beta0_nm1.array()(i) << "\n";
+    if (!async_checkpoint) {
+
+        for (int i = 0; i < chk_mf.size(); ++i) {
+            VisMF::Write(*chk_mf[i], chk_prefix[i]);
+        }
+
+        if (ParallelDescriptor::IOProcessor()) {
+            if (!WriteBaseState(checkpointname, base_cc, base_fc)) {
+                amrex::FileOpenFailed(checkpointname + "/BaseCC");
+            }
         }
+
+        return;
     }
 
-    // write out the face-centered base state
-    if (ParallelDescriptor::IOProcessor()) {
+    // stage a copy of the data (in pinned host memory on GPUs) so that the
+    // state can keep evolving while it is written
+    MFInfo info;
+#ifdef AMREX_USE_GPU
+    info.SetArena(The_Pinned_Arena());
+#endif
+    chk_staging.clear();
+    for (int i = 0; i < chk_mf.size(); ++i) {
+        const MultiFab& mf = *chk_mf[i];
+        chk_staging.emplace_back(new MultiFab(mf.boxArray(), mf.DistributionMap(),
+                                              mf.nComp(), mf.nGrow(), info));
+        MultiFab::Copy(*chk_staging.back(), mf, 0, 0, mf.nComp(), mf.nGrow());
+    }
+    Gpu::synchronize();
 
-        std::ofstream BaseFCFile;
-        BaseFCFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-        std::string BaseFCFileName(checkpointname + "/BaseFC");
-        BaseFCFile.open(BaseFCFileName.c_str(), std::ofstream::out   |
-                        std::ofstream::trunc |
-                        std::ofstream::binary);
-        if( !BaseFCFile.good()) {
-            amrex::FileOpenFailed(BaseFCFileName);
+    // the data files are created here, where a barrier can wait for them,
+    // and filled in place by the writer threads
+    const int nfiles = AsyncNFiles();
+    for (int i = 0; i < chk_prefix.size(); ++i) {
+        CreateSharedFabFile(chk_prefix[i], nfiles);
+    }
+    ParallelDescriptor::Barrier();
+
+    chk_pending = true;
+    chk_pending_name = amrex::Concatenate(check_base_name,step,7);
+    chk_done = 0;
+    chk_ok = 1;
+
+    // the writer thread only does local file I/O -- all communication
+    // happens on the main thread in FinishCheckPoint
+    const bool ioproc = ParallelDescriptor::IOProcessor();
+    chk_thread = std::thread([this, chk_prefix, checkpointname, ioproc, nfiles,
+                              base_cc = std::move(base_cc),
+                              base_fc = std::move(base_fc)] () {
+        bool ok = true;
+        for (int i = 0; i < chk_staging.size(); ++i) {
+            ok = WriteLocalFabs(*chk_staging[i], chk_prefix[i], nfiles) && ok;
+        }
+        if (ioproc) {
+            ok = WriteBaseState(checkpointname, base_cc, base_fc) && ok;
         }
+        chk_ok = ok ? 1 : 0;
+        chk_done = 1;
+    });
+}
 
-        BaseFCFile.precision(17);
+void
+Maestro::FinishCheckPoint (bool wait)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FinishCheckPoint()",FinishCheckPoint);
 
-        for (int i=0; i<(base_geom.max_radial_level+1)*(base_geom.nr_fine+1); ++i) {
-            BaseFCFile << w0.array()(i) << " "
-                       << etarho_ec.array()(i) << "\n";
+    if (!chk_pending) {
+        return;
+    }
+
+    if (!wait) {
+        // only go on if every processor's writer is done
+        int done = chk_done;
+        ParallelDescriptor::ReduceIntMin(done);
+        if (!done) {
+            return;
         }
     }
 
-    WriteJobInfo(checkpointname);
+    chk_thread.join();
+    chk_staging.clear();
+    chk_pending = false;
+
+    int ok = chk_ok;
+    ParallelDescriptor::ReduceIntMin(ok);
+
+    const std::string tempname = chk_pending_name + ".temp";
+
+    if (!ok) {
+        Abort("asynchronous checkpoint " + tempname + " failed to write");
+    }
+
+    // publish the checkpoint under its final name
+    if (ParallelDescriptor::IOProcessor()) {
+        if (amrex::FileExists(chk_pending_name)) {
+            amrex::UtilRenameDirectoryToOld(chk_pending_name, false);
+        }
+        if (std::rename(tempname.c_str(), chk_pending_name.c_str()) != 0) {
+            Abort("unable to rename " + tempname + " to " + chk_pending_name);
+        }
+    }
+    ParallelDescriptor::Barrier();
+
+    Print() << "Finished checkpoint " << chk_pending_name << "\n";
 }
 
 int
@@ -177,6 +496,25 @@ Maestro::ReadCheckPoint ()
 
     amrex::Print() << "Restart from checkpoint " << restart_file << "\n";
 
+    // an asynchronous checkpoint that never finished writing
+    const std::string temp_suffix {".temp"};
+    if (restart_file.size() >= temp_suffix.size() &&
+        restart_file.compare(restart_file.size() - temp_suffix.size(),
+                             temp_suffix.size(), temp_suffix) == 0) {
+        Abort("ReadCheckPoint: " + restart_file + " is an incomplete checkpoint");
+    }
+
+    // number of data files per MultiFab of an asynchronous checkpoint, or
+    // 0 if the MultiFab data is in VisMF format
+    int async_nfiles = 0;
+    if (amrex::FileExists(restart_file + "/AsyncFabs")) {
+        Vector<char> fileCharPtr;
+        ParallelDescriptor::ReadAndBcastFile(restart_file + "/AsyncFabs", fileCharPtr);
+        std::string fileCharPtrString(fileCharPtr.dataPtr());
+        std::istringstream is(fileCharPtrString, std::istringstream::in);
+        is >> async_nfiles;
+    }
+
     VisMF::IO_Buffer io_buffer(VisMF::GetIOBufferSize());
 
     std::string line, word;
@@ -249,7 +587,24 @@ Maestro::ReadCheckPoint ()
     }
 
     // read in the MultiFab data - put it in the "old" MultiFabs
-    for (int lev = 0; lev <= finest_level; ++lev) {
+    for (int lev = 0; lev <= finest_level && async_nfiles > 0; ++lev) {
+        ReadLocalFabs(sold[lev],
+                      amrex::MultiFabFileFullPrefix(lev, restart_file, "Level_", "snew"), async_nfiles);
+        ReadLocalFabs(uold[lev],
+                      amrex::MultiFabFileFullPrefix(lev, restart_file, "Level_", "unew"), async_nfiles);
+        ReadLocalFabs(gpi[lev],
+                      amrex::MultiFabFileFullPrefix(lev, restart_file, "Level_", "gpi"), async_nfiles);
+        ReadLocalFabs(dSdt[lev],
+                      amrex::MultiFabFileFullPrefix(lev, restart_file, "Level_", "dSdt"), async_nfiles);
+        ReadLocalFabs(S_cc_old[lev],
+                      amrex::MultiFabFileFullPrefix(lev, restart_file, "Level_", "S_cc_new"), async_nfiles);
+#ifdef SDC
+        ReadLocalFabs(intra[lev],
+                      amrex::MultiFabFileFullPrefix(lev, restart_file, "Level_", "intra"), async_nfiles);
+#endif
+    }
+
+    for (int lev = 0; lev <= finest_level && async_nfiles == 0; ++lev) {
         VisMF::Read(sold[lev],
                     amrex::MultiFabFileFullPrefix(lev, restart_file, "Level_", "snew"));
         VisMF::Read(uold[lev],
@@ -73,7 +73,7 @@ Maestro::PutInPertForm(int level,
 
 void
 Maestro::ConvertRhoXToX(Vector<MultiFab>& scal,
-                        bool flag)
+                        bool flag, bool fill_ghost)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::ConvertRhoXToX()",ConvertRhoXToX);
@@ -94,6 +94,9 @@ Maestro::ConvertRhoXToX(Vector<MultiFab>& scal,
 
     // average down data and fill ghost cells
     AverageDown(scal, FirstSpec, NumSpec);
+    if (!fill_ghost) {
+        return;
+    }
     if (flag) {
         FillPatch(t_old,scal,scal,scal,FirstSpec,FirstSpec,NumSpec,0,bcs_f);
     } else {
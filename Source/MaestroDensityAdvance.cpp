@@ -95,6 +95,12 @@ Maestro::DensityAdvance (int which_step,
     // Create the edge states of (rho X)' or X and rho'
     /////////////////////////////////////////////////////////////////
 
+    // with async_ghost_fill, the ghost cells of X are exchanged while
+    // MakeEdgeScal works on the box interiors that do not need them
+    const bool fill_X_async = async_ghost_fill &&
+        (species_pred_type == predict_rhoprime_and_X ||
+         species_pred_type == predict_rho_and_X);
+
     if ((species_pred_type == predict_rhoprime_and_X) ||
         (species_pred_type == predict_rho_and_X)) {
 
@@ -102,7 +108,7 @@ Maestro::DensityAdvance (int which_step,
         // data to those quantities
 
         // convert (rho X) --> X in scalold
-        ConvertRhoXToX(scalold, true);
+        ConvertRhoXToX(scalold, true, !fill_X_async);
     }
 
     if (species_pred_type == predict_rhoprime_and_X) {
@@ -111,37 +117,69 @@ Maestro::DensityAdvance (int which_step,
         PutInPertForm(scalold, rho0_old, Rho, 0, bcs_f, true);
     }
 
-    // predict species at the edges -- note, either X or (rho X) will be
-    // predicted here, depending on species_pred_type
+    if (fill_X_async) {
+        // the fill ConvertRhoXToX skipped; MakeEdgeScal (or UpdateRhoXFused)
+        // finishes it
+        FillPatchAsync(t_old, scalold, FirstSpec, NumSpec, 0, bcs_f);
+    }
 
-    int is_vel = 0; // false
-    if (species_pred_type == predict_rhoprime_and_X ||
-        species_pred_type == predict_rho_and_X) {
+    // with fuse_scalar_update, the edge states, fluxes and update of the
+    // species are done in a single pass.  This needs the coarse fluxes to be
+    // corrected by refluxing after the update, rather than averaged down
+    // before it.
+    const bool fuse_update = fuse_scalar_update && !spherical &&
+        (finest_level == 0 || reflux_type == 2);
+
+    if (fuse_update) {
+
+        // the force for (rho X)_i at time n+1/2 is zero, as is the force
+        // used to predict them, so scal_force is only read for rho
+        if (which_step == 1) {
+            UpdateRhoXFused(scalold, scalnew, sflux, etarhoflux, sedge, umac,
+                            rho0_old, rho0_edge_old,
+                            rho0_old, rho0_edge_old,
+                            rho0_predicted_edge, scal_force);
+        } else {
+            UpdateRhoXFused(scalold, scalnew, sflux, etarhoflux, sedge, umac,
+                            rho0_old, rho0_edge_old,
+                            rho0_new, rho0_edge_new,
+                            rho0_predicted_edge, scal_force);
+        }
 
-        // we are predicting X to the edges, using the advective form of
-        // the prediction
-        MakeEdgeScal(scalold, sedge, umac, scal_force, is_vel, bcs_s, 
-                     Nscal, FirstSpec, FirstSpec, NumSpec, 0);
+    } else {
 
-    } else if (species_pred_type == predict_rhoX) {
+        // predict species at the edges -- note, either X or (rho X) will be
+        // predicted here, depending on species_pred_type
 
-        MakeEdgeScal(scalold, sedge, umac, scal_force, is_vel, bcs_s,
-                     Nscal, FirstSpec, FirstSpec, NumSpec, 1);
-    }
+        int is_vel = 0; // false
+        if (species_pred_type == predict_rhoprime_and_X ||
+            species_pred_type == predict_rho_and_X) {
 
-    // predict rho or rho' at the edges (depending on species_pred_type)
-    if (species_pred_type == predict_rhoprime_and_X ||
-        species_pred_type == predict_rho_and_X) {
-        MakeEdgeScal(scalold, sedge, umac, scal_force, is_vel, bcs_s,
-                     Nscal, Rho, Rho, 1, 0);
+            // we are predicting X to the edges, using the advective form of
+            // the prediction
+            MakeEdgeScal(scalold, sedge, umac, scal_force, is_vel, bcs_s, 
+                         Nscal, FirstSpec, FirstSpec, NumSpec, 0, true);
 
-    } else if (species_pred_type == predict_rhoX) {
+        } else if (species_pred_type == predict_rhoX) {
 
-        for (int lev=0; lev<=finest_level; ++lev) {
-            for (int idim=0; idim<AMREX_SPACEDIM; ++idim) {
-                MultiFab::Copy(sedge[lev][idim],sedge[lev][idim],FirstSpec,Rho,1,0);
-                for (int ispec=1; ispec<NumSpec; ++ispec) {
-                    MultiFab::Add(sedge[lev][idim],sedge[lev][idim],FirstSpec+ispec,Rho,1,0);
+            MakeEdgeScal(scalold, sedge, umac, scal_force, is_vel, bcs_s,
+                         Nscal, FirstSpec, FirstSpec, NumSpec, 1, true);
+        }
+
+        // predict rho or rho' at the edges (depending on species_pred_type)
+        if (species_pred_type == predict_rhoprime_and_X ||
+            species_pred_type == predict_rho_and_X) {
+            MakeEdgeScal(scalold, sedge, umac, scal_force, is_vel, bcs_s,
+                         Nscal, Rho, Rho, 1, 0);
+
+        } else if (species_pred_type == predict_rhoX) {
+
+            for (int lev=0; lev<=finest_level; ++lev) {
+                for (int idim=0; idim<AMREX_SPACEDIM; ++idim) {
+                    MultiFab::Copy(sedge[lev][idim],sedge[lev][idim],FirstSpec,Rho,1,0);
+                    for (int ispec=1; ispec<NumSpec; ++ispec) {
+                        MultiFab::Add(sedge[lev][idim],sedge[lev][idim],FirstSpec+ispec,Rho,1,0);
+                    }
                 }
             }
         }
@@ -162,6 +200,14 @@ Maestro::DensityAdvance (int which_step,
     // Compute fluxes
     /////////////////////////////////////////////////////////////////
 
+    if (fuse_update) {
+        // the force for (rho X)_i at time n+1/2 is zero
+        for (int lev=0; lev<=finest_level; ++lev) {
+            scal_force[lev].setVal(0.);
+        }
+        return;
+    }
+
     if (which_step == 1) {
         Vector< std::array< MultiFab,AMREX_SPACEDIM > > rho0mac_old(finest_level+1);
 #if (AMREX_SPACEDIM == 3)
@@ -360,12 +406,12 @@ Maestro::DensityAdvanceSDC (int which_step,
         // the prediction
         MakeEdgeScal(scalold, sedge, umac, scal_force, 
                      is_vel, bcs_s, Nscal, FirstSpec,
-                     FirstSpec, NumSpec, 0);
+                     FirstSpec, NumSpec, 0, true);
 
     } else if (species_pred_type == predict_rhoX) {
         MakeEdgeScal(scalold, sedge, umac, scal_force, 
                      is_vel, bcs_s, Nscal, FirstSpec,
-                     FirstSpec, NumSpec, 1);
+                     FirstSpec, NumSpec, 1, true);
     }
     
     // predict rho or rho' at the edges (depending on species_pred_type)
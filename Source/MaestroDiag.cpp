@@ -25,6 +25,9 @@ Maestro::DiagFile (const int step,
 
     // timer for profiling
     BL_PROFILE_VAR("Maestro::DiagFile()", DiagFile);
+
+    // complete any reductions still in flight from the previous call
+    FinishDiagFile(index);
     
     // -- w0mac will contain an edge-centered w0 on a Cartesian grid,
     // -- for use in computing divergences.
@@ -99,7 +102,6 @@ Maestro::DiagFile (const int step,
     int ncenter = 0;
     Vector<Real> coord_Tmax(AMREX_SPACEDIM,0.0);
     Vector<Real> vel_Tmax(AMREX_SPACEDIM,0.0);
-    Real Rloc_Tmax = 0.0, vr_Tmax = 0.0;
 
     // diag_vel.out
     Real U_max = 0.0, Mach_max = 0.0;
@@ -110,7 +112,6 @@ Maestro::DiagFile (const int step,
     Real enuc_max = 0.0;
     Vector<Real> coord_enucmax(AMREX_SPACEDIM,0.0);
     Vector<Real> vel_enucmax(AMREX_SPACEDIM,0.0);
-    Real Rloc_enucmax = 0.0, vr_enucmax = 0.0;
     Real nuc_ener = 0.0;
 
     for (int lev = 0; lev <= finest_level; ++lev) {
@@ -146,6 +147,8 @@ Maestro::DiagFile (const int step,
         const BoxArray& fba = s_in[finelev].boxArray();
         const iMultiFab& mask = makeFineMask(s_in[lev], fba, IntVect(2));
 
+        MultiFab* eos_cache_mf = EOSCacheMF(lev, s_in[lev]);
+
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel reduction(+:kin_ener_level) reduction(+:int_ener_level) reduction(+:nuc_ener_level) reduction(max:U_max_level) reduction(max:Mach_max_level)
@@ -164,6 +167,8 @@ Maestro::DiagFile (const int step,
             const Array4<const Real> rho_Hnuc_arr = rho_Hnuc[lev].array(mfi);
             const Array4<const Real> u = u_in[lev].array(mfi);
             const Array4<const int> mask_arr = mask.array(mfi);
+            const Array4<Real> eos_cache_arr = eos_cache_mf ?
+                eos_cache_mf->array(mfi) : Array4<Real>();
             const auto w0_arr = w0.const_array();
 
             // weight is the factor by which the volume of a cell at the current level
@@ -310,7 +315,7 @@ Maestro::DiagFile (const int step,
                         eos_state.xn[comp] = scal(i,j,k,FirstSpec+comp)/eos_state.rho;
                     }
                         
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(eos_cache_arr, i, j, k, eos_state);
 
                     // kinetic, internal, and nuclear energies
                     kin_ener_level += weight * scal(i,j,k,Rho) * vel*vel;
@@ -324,182 +329,39 @@ Maestro::DiagFile (const int step,
             }}}
         } // end MFIter
 
-        // sum quantities over all processors
-        ParallelDescriptor::ReduceRealSum(T_center_level);
-        ParallelDescriptor::ReduceRealSum(vel_center_level.dataPtr(),AMREX_SPACEDIM);
-        ParallelDescriptor::ReduceRealSum(kin_ener_level);
-        ParallelDescriptor::ReduceRealSum(int_ener_level);
-        ParallelDescriptor::ReduceRealSum(nuc_ener_level);
-        ParallelDescriptor::ReduceIntSum(ncenter_level);
-
-        // find the largest U and Mach number over all processors
-        ParallelDescriptor::ReduceRealMax(U_max_level);
-        ParallelDescriptor::ReduceRealMax(Mach_max_level);
-
-        // for T_max, we want to know where the hot spot is, so we do a
-        // gather on the temperature and find the index corresponding to
-        // the maxiumum.  We then pack the coordinates and velocities
-        // into a local array and gather that to the I/O processor and
-        // pick the values corresponding to the maximum.
-        int nprocs = ParallelDescriptor::NProcs();
-        int ioproc = ParallelDescriptor::IOProcessorNumber();
-        Vector<Real> T_max_data(nprocs);
-
-        if (nprocs == 1) {
-            T_max_data[0] = T_max_local;
-        } else {
-            ParallelDescriptor::Gather(&T_max_local, 1, &T_max_data[0], 1, ioproc);
-        }
-
-        // determine index of max global T
-        int index_max = 0;
-        Real T_max_level = 0.0;
-        for (int ip = 0; ip < nprocs; ++ip) {
-            if (T_max_data[ip] > T_max_level) {
-                T_max_level = T_max_data[ip];
-                index_max = ip;
-            }
-        }
-
-        // T_max_coords will contain both the coordinate information and
-        // the velocity information, so there are 2*dm values on each
-        // proc
-        Vector<Real> T_max_coords(2*AMREX_SPACEDIM);
-        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-            T_max_coords[i] = coord_Tmax_local[i];
-            T_max_coords[i+AMREX_SPACEDIM] = vel_Tmax_local[i];
-        }
+        // combine this level with the coarser ones.  This is done
+        // locally on each rank; the reduction over ranks is done once,
+        // for all levels, below
+        kin_ener += kin_ener_level;
+        int_ener += int_ener_level;
+        nuc_ener += nuc_ener_level;
 
-        Vector<Real> T_max_coords_level(2*AMREX_SPACEDIM*nprocs);
+        U_max = max(U_max, U_max_level);
+        Mach_max = max(Mach_max, Mach_max_level);
 
-        if (nprocs == 1) {
-            for (int i = 0; i < 2*AMREX_SPACEDIM; ++i) {
-                T_max_coords_level[i] = T_max_coords[i];
-            }
-        } else {
-            ParallelDescriptor::Gather(&T_max_coords[0], 2*AMREX_SPACEDIM, &T_max_coords_level[0], 2*AMREX_SPACEDIM, ioproc);
-        }
-
-        // initialize global variables
-        Vector<Real> coord_Tmax_level(AMREX_SPACEDIM);
-        Vector<Real> vel_Tmax_level(AMREX_SPACEDIM);
-
-        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-            coord_Tmax_level[i] = T_max_coords_level[2*AMREX_SPACEDIM*index_max+i];
-            vel_Tmax_level[i] = T_max_coords_level[2*AMREX_SPACEDIM*index_max+i+AMREX_SPACEDIM];
-        }
-
-        // for enuc_max, we also want to know where the hot spot is, so
-        // we do the same gather procedure as with the temperature
-        Vector<Real> enuc_max_data(nprocs);
-
-        if (nprocs == 1) {
-            enuc_max_data[0] = enuc_max_local;
-        } else {
-            ParallelDescriptor::Gather(&enuc_max_local, 1, &enuc_max_data[0], 1, ioproc);
-        }
-
-        // determine index of max global enuc
-        index_max = 0;
-        Real enuc_max_level = 0.0;
-        for (int ip = 0; ip < nprocs; ++ip) {
-            if (enuc_max_data[ip] > enuc_max_level) {
-                enuc_max_level = enuc_max_data[ip];
-                index_max = ip;
+        // if T_max_local is the new max, then copy the location as well
+        if (T_max_local > T_max) {
+            T_max = T_max_local;
+            for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                coord_Tmax[i] = coord_Tmax_local[i];
+                vel_Tmax[i] = vel_Tmax_local[i];
             }
         }
 
-        Vector<Real> enuc_max_coords(2*AMREX_SPACEDIM);
-        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-            enuc_max_coords[i] = coord_enucmax_local[i];
-            enuc_max_coords[i+AMREX_SPACEDIM] = vel_enucmax_local[i];
-        }
-
-        Vector<Real> enuc_max_coords_level(2*AMREX_SPACEDIM*nprocs);
-        if (nprocs == 1) {
-            for (int i = 0; i < 2*AMREX_SPACEDIM; ++i) {
-                enuc_max_coords_level[i] = enuc_max_coords[i];
+        // if enuc_max_local is the new max, then copy the location as well
+        if (enuc_max_local > enuc_max) {
+            enuc_max = enuc_max_local;
+            for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                coord_enucmax[i] = coord_enucmax_local[i];
+                vel_enucmax[i] = vel_enucmax_local[i];
             }
-        } else {
-            ParallelDescriptor::Gather(&enuc_max_coords[0], 2*AMREX_SPACEDIM,
-                                       &enuc_max_coords_level[0], 2*AMREX_SPACEDIM, ioproc);
         }
 
-        // initialize global variables
-        Vector<Real> coord_enucmax_level(AMREX_SPACEDIM);
-        Vector<Real> vel_enucmax_level(AMREX_SPACEDIM);
-
+        T_center += T_center_level;
         for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-            coord_enucmax_level[i] = enuc_max_coords_level[2*AMREX_SPACEDIM*index_max+i];
-            vel_enucmax_level[i] = enuc_max_coords_level[2*AMREX_SPACEDIM*index_max+i+AMREX_SPACEDIM];
-        }
-
-        // reduce the current level's data with the global data
-        if (ParallelDescriptor::IOProcessor()) {
-
-            kin_ener += kin_ener_level;
-            int_ener += int_ener_level;
-            nuc_ener += nuc_ener_level;
-
-            U_max = max(U_max, U_max_level);
-            Mach_max = max(Mach_max, Mach_max_level);
-
-            // if T_max_level is the new max, then copy the location as well
-            if (T_max_level > T_max) {
-                T_max = T_max_level;
-
-                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-                    coord_Tmax[i] = coord_Tmax_level[i];
-                    vel_Tmax[i] = vel_Tmax_level[i];
-                }
-
-#if (AMREX_SPACEDIM == 3)
-                if (spherical) { 
-                  // compute the radius of the bubble from the center of the star
-                  Rloc_Tmax = std::sqrt( (coord_Tmax[0] - center[0])*(coord_Tmax[0] - center[0]) +
-                                    (coord_Tmax[1] - center[1])*(coord_Tmax[1] - center[1]) +
-                                    (coord_Tmax[2] - center[2])*(coord_Tmax[2] - center[2]) );
-
-                  // use the coordinates of the hot spot and the velocity components
-                  // to compute the radial velocity at the hotspot
-                  vr_Tmax = ((coord_Tmax[0] - center[0])/Rloc_Tmax)*vel_Tmax[0] +
-                            ((coord_Tmax[1] - center[1])/Rloc_Tmax)*vel_Tmax[1] +
-                            ((coord_Tmax[2] - center[2])/Rloc_Tmax)*vel_Tmax[2];
-                }
-#endif
-            }
-
-            // if enuc_max_level is the new max, then copy the location as well
-            if (enuc_max_level > enuc_max) {
-                enuc_max = enuc_max_level;
-
-                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-                    coord_enucmax[i] = coord_enucmax_level[i];
-                    vel_enucmax[i] = vel_enucmax_level[i];
-                }
-
-#if (AMREX_SPACEDIM == 3)
-                if (spherical) { 
-                  // compute the radius of the bubble from the center
-                  Rloc_enucmax = std::sqrt( (coord_enucmax[0] - center[0])*(coord_enucmax[0] - center[0]) +
-                                       (coord_enucmax[1] - center[1])*(coord_enucmax[1] - center[1]) +
-                                       (coord_enucmax[2] - center[2])*(coord_enucmax[2] - center[2]) );
-  
-                  // use the coordinates of the hot spot and the velocity components
-                  // to compute the radial velocity at the hotspot
-                  vr_enucmax = ((coord_enucmax[0] - center[0])/Rloc_enucmax)*vel_enucmax[0] +
-                               ((coord_enucmax[1] - center[1])/Rloc_enucmax)*vel_enucmax[1] +
-                               ((coord_enucmax[2] - center[2])/Rloc_enucmax)*vel_enucmax[2];
-                }
-#endif
-            }
-
-            T_center += T_center_level;
-            for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-                vel_center[i] += vel_center_level[i];
-            }
-            ncenter += ncenter_level;
+            vel_center[i] += vel_center_level[i];
         }
+        ncenter += ncenter_level;
     }
 
     // compute the graviational potential energy too
@@ -561,239 +423,424 @@ Maestro::DiagFile (const int step,
         }
     }
 
-    // normalize
-    if (ParallelDescriptor::IOProcessor()) {
+    // pack the sums into one buffer and the maxima, each followed by the
+    // coordinates and velocity at its location, into another, so that
+    // each needs only a single reduction over all ranks
+    diag_sum_send.assign({T_center, kin_ener, int_ener, nuc_ener, Real(ncenter)});
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        diag_sum_send.push_back(vel_center[i]);
+    }
 
-        // the volume we normalize with is that of a single coarse-level
-        // zone.  This is because the weight used in the loop over cells
-        // was with reference to the coarse level
-        const Real* dx = geom[0].CellSize();
-        for (auto i = 0; i < AMREX_SPACEDIM; ++i) {
-            kin_ener *= dx[i];
-            int_ener *= dx[i];
-            nuc_ener *= dx[i];
-        }
+    const int nmaxloc = 1 + 2*AMREX_SPACEDIM;
+    diag_max_send.assign(4*nmaxloc, 0.0);
+    diag_max_send[0] = T_max;
+    diag_max_send[nmaxloc] = enuc_max;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        diag_max_send[1+i] = coord_Tmax[i];
+        diag_max_send[1+AMREX_SPACEDIM+i] = vel_Tmax[i];
+        diag_max_send[nmaxloc+1+i] = coord_enucmax[i];
+        diag_max_send[nmaxloc+1+AMREX_SPACEDIM+i] = vel_enucmax[i];
+    }
+    diag_max_send[2*nmaxloc] = U_max;
+    diag_max_send[3*nmaxloc] = Mach_max;
 
-        if (spherical) {
-            // for a full star ncenter should be 8 -- there are only 8 zones
-            // that have a vertex at the center of the star.  For an octant,
-            // ncenter should be 1
-            if (!((ncenter == 8 && !octant) || (ncenter == 1 && octant))) {
-                Abort("ERROR: ncenter invalid in Diag()");
-            } else {
-                T_center /= ncenter;
-                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
-                    vel_center[i] /= ncenter;
+    diag_pending_step = step;
+    diag_pending_time = t_in;
+    diag_pending_dt = dt;
+    diag_pending_grav_ener = grav_ener;
+
+    PostDiagReductions();
+
+    // at initialization we always write immediately; otherwise, if
+    // diag_nonblocking is set, the reductions overlap with whatever comes
+    // next (the next step's EstDt) and are completed by FinishDiagFile
+    if (step == 0 || !diag_nonblocking) {
+        FinishDiagFile(index);
+    }
+}
+
+#ifdef BL_USE_MPI
+namespace
+{
+    // MPI reduction operator for records of (value, coordinates,
+    // velocity): keep the record with the largest value.  Ties go to
+    // the lower rank, as the operator is registered as non-commutative.
+    void DiagMaxLocOp (void* invec, void* inoutvec, int* len, MPI_Datatype* dtype)
+    {
+        int reclen = 0;
+        MPI_Type_size(*dtype, &reclen);
+        reclen /= sizeof(Real);
+
+        const Real* in = static_cast<const Real*>(invec);
+        Real* inout = static_cast<Real*>(inoutvec);
+
+        for (int n = 0; n < *len; ++n) {
+            if (in[n*reclen] >= inout[n*reclen]) {
+                for (int m = 0; m < reclen; ++m) {
+                    inout[n*reclen+m] = in[n*reclen+m];
                 }
             }
         }
     }
+}
+#endif
 
-    // write out diagnosis data if at initialization
-    if (ParallelDescriptor::IOProcessor()) {
-        const std::string& diagfilename1 = "diag_temp.out";
-        std::ofstream diagfile1;
-        const std::string& diagfilename2 = "diag_enuc.out";
-        std::ofstream diagfile2;
-        const std::string& diagfilename3 = "diag_vel.out";
-        std::ofstream diagfile3;
-
-        // num of variables in the outfile depends on geometry but not dimension
-        const int ndiag1 = (spherical) ? 11 : 8;
-        const int ndiag2 = (spherical) ? 11 : 9;
-        const int ndiag3 = (spherical) ? 10 : 7;
-
-        if (step == 0) {
-
-            // create file after initialization
-            diagfile1.open(diagfilename1, std::ofstream::out |
-                           std::ofstream::trunc | std::ofstream::binary);
-
-            // diag_temp.out
-            // write variable names
-            diagfile1 << std::setw(setwVal) << std::left << "time";
-            diagfile1 << std::setw(setwVal) << std::left << "max{T}";
-            diagfile1 << std::setw(setwVal) << std::left << "x(max{T})";
-            diagfile1 << std::setw(setwVal) << std::left << "y(max{T})";
-            diagfile1 << std::setw(setwVal) << std::left << "z(max{T})";
-            diagfile1 << std::setw(setwVal) << std::left << "vx(max{T})";
-            diagfile1 << std::setw(setwVal) << std::left << "vy(max{T})";
-            diagfile1 << std::setw(setwVal) << std::left << "vz(max{T})";
-            if (spherical) {
-                diagfile1 << std::setw(setwVal) << std::left << "R(max{T})";
-                diagfile1 << std::setw(setwVal) << std::left << "vr(max{T})";
-                diagfile1 << std::setw(setwVal) << std::left << "T_center" << std::endl;
-            } else {
-                diagfile1 << std::endl;
-            }
+// start the reductions of the packed DiagFile sums and maxima to the I/O
+// processor
+void
+Maestro::PostDiagReductions ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::PostDiagReductions()", PostDiagReductions);
 
-            // write data
-            diagfile1.precision(outfilePrecision);
-            diagfile1 << std::scientific;
-            diagfile1 << std::setw(setwVal) << std::left << t_in;
-            diagfile1 << std::setw(setwVal) << std::left << T_max;
-
-            const Real coord_temp_max_y = coord_Tmax[1];
-            const Real coord_temp_max_z = (AMREX_SPACEDIM == 2) ? 0.0 : coord_Tmax[2];
-            diagfile1 << std::setw(setwVal) << std::left << coord_Tmax[0];
-            diagfile1 << std::setw(setwVal) << std::left << coord_temp_max_y;
-            diagfile1 << std::setw(setwVal) << std::left << coord_temp_max_z;
-
-            const Real vel_temp_max_y = vel_Tmax[1];
-            const Real vel_temp_max_z = (AMREX_SPACEDIM == 2) ? 0.0 : vel_Tmax[2];
-            diagfile1 << std::setw(setwVal) << std::left << vel_Tmax[0];
-            diagfile1 << std::setw(setwVal) << std::left << vel_temp_max_y;
-            diagfile1 << std::setw(setwVal) << std::left << vel_temp_max_z;
-
-            if (spherical) {
-                diagfile1 << std::setw(setwVal) << std::left << Rloc_Tmax;
-                diagfile1 << std::setw(setwVal) << std::left << vr_Tmax;
-                diagfile1 << std::setw(setwVal) << std::left << T_center << std::endl;
-            } else {
-                diagfile1 << std::endl;
-            }
+    const int nmaxloc = 1 + 2*AMREX_SPACEDIM;
 
-            // close files
-            diagfile1.close();
-
-            // diag_enuc.out
-            diagfile2.open(diagfilename2, std::ofstream::out |
-                           std::ofstream::trunc | std::ofstream::binary);
-            // write variable names
-            diagfile2 << std::setw(setwVal) << std::left << "time";
-            diagfile2 << std::setw(setwVal) << std::left << "max{enuc}";
-            diagfile2 << std::setw(setwVal) << std::left << "x(max{enuc})";
-            diagfile2 << std::setw(setwVal) << std::left << "y(max{enuc})";
-            diagfile2 << std::setw(setwVal) << std::left << "z(max{enuc})";
-            diagfile2 << std::setw(setwVal) << std::left << "vx(max{enuc})";
-            diagfile2 << std::setw(setwVal) << std::left << "vy(max{enuc})";
-            diagfile2 << std::setw(setwVal) << std::left << "vz(max{enuc})";
-            if (spherical) {
-                diagfile2 << std::setw(setwVal) << std::left << "R(max{enuc})";
-                diagfile2 << std::setw(setwVal) << std::left << "vr(max{enuc})";
-            }
-            diagfile2 << std::setw(setwVal) << std::left << "tot nuc ener(erg/s)" << std::endl;
-
-            // write data
-            diagfile2.precision(outfilePrecision);
-            diagfile2 << std::scientific;
-            diagfile2 << std::setw(setwVal) << std::left << t_in;
-            diagfile2 << std::setw(setwVal) << std::left << enuc_max;
-
-            const Real coord_enuc_y = coord_enucmax[1];
-            const Real coord_enuc_z = (AMREX_SPACEDIM == 2) ? 0.0 : coord_enucmax[2];
-            diagfile2 << std::setw(setwVal) << std::left << coord_enucmax[0];
-            diagfile2 << std::setw(setwVal) << std::left << coord_enuc_y;
-            diagfile2 << std::setw(setwVal) << std::left << coord_enuc_z;
-
-            const Real vel_enuc_y = vel_enucmax[1];
-            const Real vel_enuc_z = (AMREX_SPACEDIM == 2) ? 0.0 : vel_enucmax[2];
-            diagfile2 << std::setw(setwVal) << std::left << vel_enucmax[0];
-            diagfile2 << std::setw(setwVal) << std::left << vel_enuc_y;
-            diagfile2 << std::setw(setwVal) << std::left << vel_enuc_z;
-
-            if (spherical) {
-                diagfile2 << std::setw(setwVal) << std::left << Rloc_enucmax;
-                diagfile2 << std::setw(setwVal) << std::left << vr_enucmax;
-            }
-            diagfile2 << std::setw(setwVal) << std::left << nuc_ener << std::endl;
-
-            // close file
-            diagfile2.close();
-
-            // diag_vel.out
-            diagfile3.open(diagfilename3, std::ofstream::out |
-                           std::ofstream::trunc | std::ofstream::binary);
-            // write variable names
-            diagfile3 << std::setw(setwVal) << std::left << "time";
-            diagfile3 << std::setw(setwVal) << std::left << "max{U}";
-            diagfile3 << std::setw(setwVal) << std::left << "max{Mach}";
-            diagfile3 << std::setw(setwVal) << std::left << "tot kin energy";
-            diagfile3 << std::setw(setwVal) << std::left << "tot grav energy";
-            diagfile3 << std::setw(setwVal) << std::left << "tot int energy";
-            if (spherical) {
-                diagfile3 << std::setw(setwVal) << std::left << "velx_center";
-                diagfile3 << std::setw(setwVal) << std::left << "vely_center";
-                diagfile3 << std::setw(setwVal) << std::left << "velz_center";
-            }
-            diagfile3 << std::setw(setwVal) << std::left << "dt" << std::endl;
-
-            // write data
-            diagfile3.precision(outfilePrecision);
-            diagfile3 << std::scientific;
-            diagfile3 << std::setw(setwVal) << std::left << t_in;
-            diagfile3 << std::setw(setwVal) << std::left << U_max;
-            diagfile3 << std::setw(setwVal) << std::left << Mach_max;
-            diagfile3 << std::setw(setwVal) << std::left << kin_ener;
-            diagfile3 << std::setw(setwVal) << std::left << grav_ener;
-            diagfile3 << std::setw(setwVal) << std::left << int_ener;
-            if (spherical) {
-                diagfile3 << std::setw(setwVal) << std::left << vel_center[0];
-                diagfile3 << std::setw(setwVal) << std::left << vel_center[1];
-                diagfile3 << std::setw(setwVal) << std::left << vel_center[2];
-            }
-            diagfile3 << std::setw(setwVal) << std::left << dt << std::endl;
+    diag_sum_recv.resize(diag_sum_send.size());
+    diag_max_recv.resize(diag_max_send.size());
+
+#ifdef BL_USE_MPI
+    const MPI_Comm comm = ParallelDescriptor::Communicator();
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+    const MPI_Datatype real_type = ParallelDescriptor::Mpi_typemap<Real>::type();
+
+    MPI_Type_contiguous(nmaxloc, real_type, &diag_maxloc_type);
+    MPI_Type_commit(&diag_maxloc_type);
+    MPI_Op_create(DiagMaxLocOp, 0, &diag_maxloc_op);
+
+    MPI_Ireduce(diag_sum_send.dataPtr(), diag_sum_recv.dataPtr(),
+                static_cast<int>(diag_sum_send.size()), real_type, MPI_SUM, ioproc, comm,
+                &diag_requests[0]);
+    MPI_Ireduce(diag_max_send.dataPtr(), diag_max_recv.dataPtr(),
+                static_cast<int>(diag_max_send.size())/nmaxloc, diag_maxloc_type, diag_maxloc_op,
+                ioproc, comm, &diag_requests[1]);
+#else
+    diag_sum_recv = diag_sum_send;
+    diag_max_recv = diag_max_send;
+#endif
+
+    diag_pending = true;
+}
+
+// complete the reductions started by DiagFile, then write the diagnostics
+// (at initialization) or store them in the buffers
+void
+Maestro::FinishDiagFile (int& index)
+{
+    if (!diag_pending) {
+        return;
+    }
+
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FinishDiagFile()", FinishDiagFile);
+
+#ifdef BL_USE_MPI
+    MPI_Waitall(2, diag_requests, MPI_STATUSES_IGNORE);
+    MPI_Op_free(&diag_maxloc_op);
+    MPI_Type_free(&diag_maxloc_type);
+#endif
 
-            // close file
-            diagfile3.close();
+    diag_pending = false;
 
+    const int step = diag_pending_step;
+    const Real t_in = diag_pending_time;
+    const Real dt = diag_pending_dt;
+    const Real grav_ener = diag_pending_grav_ener;
+
+    // the reduced values are only valid on the I/O processor
+    if (!ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    // unpack the sums
+    Real T_center = diag_sum_recv[0];
+    Real kin_ener = diag_sum_recv[1];
+    Real int_ener = diag_sum_recv[2];
+    Real nuc_ener = diag_sum_recv[3];
+    const int ncenter = static_cast<int>(diag_sum_recv[4] + 0.5);
+    Vector<Real> vel_center(AMREX_SPACEDIM);
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        vel_center[i] = diag_sum_recv[5+i];
+    }
+
+    // unpack the maxima and their locations
+    const int nmaxloc = 1 + 2*AMREX_SPACEDIM;
+    const Real T_max = diag_max_recv[0];
+    const Real enuc_max = diag_max_recv[nmaxloc];
+    const Real U_max = diag_max_recv[2*nmaxloc];
+    const Real Mach_max = diag_max_recv[3*nmaxloc];
+    Vector<Real> coord_Tmax(AMREX_SPACEDIM);
+    Vector<Real> vel_Tmax(AMREX_SPACEDIM);
+    Vector<Real> coord_enucmax(AMREX_SPACEDIM);
+    Vector<Real> vel_enucmax(AMREX_SPACEDIM);
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        coord_Tmax[i] = diag_max_recv[1+i];
+        vel_Tmax[i] = diag_max_recv[1+AMREX_SPACEDIM+i];
+        coord_enucmax[i] = diag_max_recv[nmaxloc+1+i];
+        vel_enucmax[i] = diag_max_recv[nmaxloc+1+AMREX_SPACEDIM+i];
+    }
+
+    Real Rloc_Tmax = 0.0, vr_Tmax = 0.0;
+    Real Rloc_enucmax = 0.0, vr_enucmax = 0.0;
+
+#if (AMREX_SPACEDIM == 3)
+    if (spherical) {
+        // compute the radius of the bubble from the center of the star
+        Rloc_Tmax = std::sqrt( (coord_Tmax[0] - center[0])*(coord_Tmax[0] - center[0]) +
+                               (coord_Tmax[1] - center[1])*(coord_Tmax[1] - center[1]) +
+                               (coord_Tmax[2] - center[2])*(coord_Tmax[2] - center[2]) );
+
+        // use the coordinates of the hot spot and the velocity components
+        // to compute the radial velocity at the hotspot
+        vr_Tmax = ((coord_Tmax[0] - center[0])/Rloc_Tmax)*vel_Tmax[0] +
+                  ((coord_Tmax[1] - center[1])/Rloc_Tmax)*vel_Tmax[1] +
+                  ((coord_Tmax[2] - center[2])/Rloc_Tmax)*vel_Tmax[2];
+
+        // compute the radius of the bubble from the center
+        Rloc_enucmax = std::sqrt( (coord_enucmax[0] - center[0])*(coord_enucmax[0] - center[0]) +
+                                  (coord_enucmax[1] - center[1])*(coord_enucmax[1] - center[1]) +
+                                  (coord_enucmax[2] - center[2])*(coord_enucmax[2] - center[2]) );
+
+        // use the coordinates of the hot spot and the velocity components
+        // to compute the radial velocity at the hotspot
+        vr_enucmax = ((coord_enucmax[0] - center[0])/Rloc_enucmax)*vel_enucmax[0] +
+                     ((coord_enucmax[1] - center[1])/Rloc_enucmax)*vel_enucmax[1] +
+                     ((coord_enucmax[2] - center[2])/Rloc_enucmax)*vel_enucmax[2];
+    }
+#endif
+
+    // normalize
+    // the volume we normalize with is that of a single coarse-level
+    // zone.  This is because the weight used in the loop over cells
+    // was with reference to the coarse level
+    const Real* dx = geom[0].CellSize();
+    for (auto i = 0; i < AMREX_SPACEDIM; ++i) {
+        kin_ener *= dx[i];
+        int_ener *= dx[i];
+        nuc_ener *= dx[i];
+    }
+
+    if (spherical) {
+        // for a full star ncenter should be 8 -- there are only 8 zones
+        // that have a vertex at the center of the star.  For an octant,
+        // ncenter should be 1
+        if (!((ncenter == 8 && !octant) || (ncenter == 1 && octant))) {
+            Abort("ERROR: ncenter invalid in Diag()");
         } else {
-            // store variable values in data array to be written later
-
-            // temp
-            diagfile1_data[index*ndiag1  ] = t_in;
-            diagfile1_data[index*ndiag1+1] = T_max;
-            const Real coord_temp_max_y = coord_Tmax[1];
-            const Real coord_temp_max_z = (AMREX_SPACEDIM == 2) ? 0.0 : coord_Tmax[2];
-            diagfile1_data[index*ndiag1+2] = coord_Tmax[0];
-            diagfile1_data[index*ndiag1+3] = coord_temp_max_y;
-            diagfile1_data[index*ndiag1+4] = coord_temp_max_z;
-            const Real vel_temp_max_y = vel_Tmax[1];
-            const Real vel_temp_max_z = (AMREX_SPACEDIM == 2) ? 0.0 : vel_Tmax[2];
-            diagfile1_data[index*ndiag1+5] = vel_Tmax[0];
-            diagfile1_data[index*ndiag1+6] = vel_temp_max_y;
-            diagfile1_data[index*ndiag1+7] = vel_temp_max_z;
-            if (spherical) {
-                diagfile1_data[index*ndiag1+8] = Rloc_Tmax;
-                diagfile1_data[index*ndiag1+9] = vr_Tmax;
-                diagfile1_data[index*ndiag1+10] = T_center;
+            T_center /= ncenter;
+            for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                vel_center[i] /= ncenter;
             }
+        }
+    }
 
-            // enuc
-            diagfile2_data[index*ndiag2  ] = t_in;
-            diagfile2_data[index*ndiag2+1] = enuc_max;
-            const Real coord_enuc_y = coord_enucmax[1];
-            const Real coord_enuc_z = (AMREX_SPACEDIM == 2) ? 0.0 : coord_enucmax[2];
-            diagfile2_data[index*ndiag2+2] = coord_enucmax[0];
-            diagfile2_data[index*ndiag2+3] = coord_enuc_y;
-            diagfile2_data[index*ndiag2+4] = coord_enuc_z;
-            const Real vel_enuc_y = vel_enucmax[1];
-            const Real vel_enuc_z = (AMREX_SPACEDIM == 2) ? 0.0 : vel_enucmax[2];
-            diagfile2_data[index*ndiag2+5] = vel_enucmax[0];
-            diagfile2_data[index*ndiag2+6] = vel_enuc_y;
-            diagfile2_data[index*ndiag2+7] = vel_enuc_z;
-            diagfile2_data[index*ndiag2+8] = Rloc_enucmax;
-            diagfile2_data[index*ndiag2+9] = vr_enucmax;
-            diagfile2_data[index*ndiag2+10] = nuc_ener;
-
-            // vel
-            diagfile3_data[index*ndiag3  ] = t_in;
-            diagfile3_data[index*ndiag3+1] = U_max;
-            diagfile3_data[index*ndiag3+2] = Mach_max;
-            diagfile3_data[index*ndiag3+3] = kin_ener;
-            diagfile3_data[index*ndiag3+4] = grav_ener;
-            diagfile3_data[index*ndiag3+5] = int_ener;
-            if (spherical) {
-                diagfile3_data[index*ndiag3+6] = vel_center[0];
-                diagfile3_data[index*ndiag3+7] = vel_center[1];
-                diagfile3_data[index*ndiag3+8] = vel_center[2];
-            }
-            const int idt = spherical ? 9 : 6;
-            diagfile3_data[index*ndiag3+idt] = dt;
+    // write out diagnosis data if at initialization, otherwise store it
+    const std::string& diagfilename1 = "diag_temp.out";
+    std::ofstream diagfile1;
+    const std::string& diagfilename2 = "diag_enuc.out";
+    std::ofstream diagfile2;
+    const std::string& diagfilename3 = "diag_vel.out";
+    std::ofstream diagfile3;
+
+    // num of variables in the outfile depends on geometry but not dimension
+    const int ndiag1 = (spherical) ? 11 : 8;
+    const int ndiag2 = (spherical) ? 11 : 9;
+    const int ndiag3 = (spherical) ? 10 : 7;
+
+    if (step == 0) {
+
+        // create file after initialization
+        diagfile1.open(diagfilename1, std::ofstream::out |
+                       std::ofstream::trunc | std::ofstream::binary);
+
+        // diag_temp.out
+        // write variable names
+        diagfile1 << std::setw(setwVal) << std::left << "time";
+        diagfile1 << std::setw(setwVal) << std::left << "max{T}";
+        diagfile1 << std::setw(setwVal) << std::left << "x(max{T})";
+        diagfile1 << std::setw(setwVal) << std::left << "y(max{T})";
+        diagfile1 << std::setw(setwVal) << std::left << "z(max{T})";
+        diagfile1 << std::setw(setwVal) << std::left << "vx(max{T})";
+        diagfile1 << std::setw(setwVal) << std::left << "vy(max{T})";
+        diagfile1 << std::setw(setwVal) << std::left << "vz(max{T})";
+        if (spherical) {
+            diagfile1 << std::setw(setwVal) << std::left << "R(max{T})";
+            diagfile1 << std::setw(setwVal) << std::left << "vr(max{T})";
+            diagfile1 << std::setw(setwVal) << std::left << "T_center" << std::endl;
+        } else {
+            diagfile1 << std::endl;
+        }
+
+        // write data
+        diagfile1.precision(outfilePrecision);
+        diagfile1 << std::scientific;
+        diagfile1 << std::setw(setwVal) << std::left << t_in;
+        diagfile1 << std::setw(setwVal) << std::left << T_max;
 
-            index += 1;
+        const Real coord_temp_max_y = coord_Tmax[1];
+        const Real coord_temp_max_z = (AMREX_SPACEDIM == 2) ? 0.0 : coord_Tmax[2];
+        diagfile1 << std::setw(setwVal) << std::left << coord_Tmax[0];
+        diagfile1 << std::setw(setwVal) << std::left << coord_temp_max_y;
+        diagfile1 << std::setw(setwVal) << std::left << coord_temp_max_z;
+
+        const Real vel_temp_max_y = vel_Tmax[1];
+        const Real vel_temp_max_z = (AMREX_SPACEDIM == 2) ? 0.0 : vel_Tmax[2];
+        diagfile1 << std::setw(setwVal) << std::left << vel_Tmax[0];
+        diagfile1 << std::setw(setwVal) << std::left << vel_temp_max_y;
+        diagfile1 << std::setw(setwVal) << std::left << vel_temp_max_z;
+
+        if (spherical) {
+            diagfile1 << std::setw(setwVal) << std::left << Rloc_Tmax;
+            diagfile1 << std::setw(setwVal) << std::left << vr_Tmax;
+            diagfile1 << std::setw(setwVal) << std::left << T_center << std::endl;
+        } else {
+            diagfile1 << std::endl;
+        }
+
+        // close files
+        diagfile1.close();
+
+        // diag_enuc.out
+        diagfile2.open(diagfilename2, std::ofstream::out |
+                       std::ofstream::trunc | std::ofstream::binary);
+        // write variable names
+        diagfile2 << std::setw(setwVal) << std::left << "time";
+        diagfile2 << std::setw(setwVal) << std::left << "max{enuc}";
+        diagfile2 << std::setw(setwVal) << std::left << "x(max{enuc})";
+        diagfile2 << std::setw(setwVal) << std::left << "y(max{enuc})";
+        diagfile2 << std::setw(setwVal) << std::left << "z(max{enuc})";
+        diagfile2 << std::setw(setwVal) << std::left << "vx(max{enuc})";
+        diagfile2 << std::setw(setwVal) << std::left << "vy(max{enuc})";
+        diagfile2 << std::setw(setwVal) << std::left << "vz(max{enuc})";
+        if (spherical) {
+            diagfile2 << std::setw(setwVal) << std::left << "R(max{enuc})";
+            diagfile2 << std::setw(setwVal) << std::left << "vr(max{enuc})";
         }
-    } // } IOProcessor
+        diagfile2 << std::setw(setwVal) << std::left << "tot nuc ener(erg/s)" << std::endl;
+
+        // write data
+        diagfile2.precision(outfilePrecision);
+        diagfile2 << std::scientific;
+        diagfile2 << std::setw(setwVal) << std::left << t_in;
+        diagfile2 << std::setw(setwVal) << std::left << enuc_max;
+
+        const Real coord_enuc_y = coord_enucmax[1];
+        const Real coord_enuc_z = (AMREX_SPACEDIM == 2) ? 0.0 : coord_enucmax[2];
+        diagfile2 << std::setw(setwVal) << std::left << coord_enucmax[0];
+        diagfile2 << std::setw(setwVal) << std::left << coord_enuc_y;
+        diagfile2 << std::setw(setwVal) << std::left << coord_enuc_z;
+
+        const Real vel_enuc_y = vel_enucmax[1];
+        const Real vel_enuc_z = (AMREX_SPACEDIM == 2) ? 0.0 : vel_enucmax[2];
+        diagfile2 << std::setw(setwVal) << std::left << vel_enucmax[0];
+        diagfile2 << std::setw(setwVal) << std::left << vel_enuc_y;
+        diagfile2 << std::setw(setwVal) << std::left << vel_enuc_z;
+
+        if (spherical) {
+            diagfile2 << std::setw(setwVal) << std::left << Rloc_enucmax;
+            diagfile2 << std::setw(setwVal) << std::left << vr_enucmax;
+        }
+        diagfile2 << std::setw(setwVal) << std::left << nuc_ener << std::endl;
+
+        // close file
+        diagfile2.close();
+
+        // diag_vel.out
+        diagfile3.open(diagfilename3, std::ofstream::out |
+                       std::ofstream::trunc | std::ofstream::binary);
+        // write variable names
+        diagfile3 << std::setw(setwVal) << std::left << "time";
+        diagfile3 << std::setw(setwVal) << std::left << "max{U}";
+        diagfile3 << std::setw(setwVal) << std::left << "max{Mach}";
+        diagfile3 << std::setw(setwVal) << std::left << "tot kin energy";
+        diagfile3 << std::setw(setwVal) << std::left << "tot grav energy";
+        diagfile3 << std::setw(setwVal) << std::left << "tot int energy";
+        if (spherical) {
+            diagfile3 << std::setw(setwVal) << std::left << "velx_center";
+            diagfile3 << std::setw(setwVal) << std::left << "vely_center";
+            diagfile3 << std::setw(setwVal) << std::left << "velz_center";
+        }
+        diagfile3 << std::setw(setwVal) << std::left << "dt" << std::endl;
+
+        // write data
+        diagfile3.precision(outfilePrecision);
+        diagfile3 << std::scientific;
+        diagfile3 << std::setw(setwVal) << std::left << t_in;
+        diagfile3 << std::setw(setwVal) << std::left << U_max;
+        diagfile3 << std::setw(setwVal) << std::left << Mach_max;
+        diagfile3 << std::setw(setwVal) << std::left << kin_ener;
+        diagfile3 << std::setw(setwVal) << std::left << grav_ener;
+        diagfile3 << std::setw(setwVal) << std::left << int_ener;
+        if (spherical) {
+            diagfile3 << std::setw(setwVal) << std::left << vel_center[0];
+            diagfile3 << std::setw(setwVal) << std::left << vel_center[1];
+            diagfile3 << std::setw(setwVal) << std::left << vel_center[2];
+        }
+        diagfile3 << std::setw(setwVal) << std::left << dt << std::endl;
+
+        // close file
+        diagfile3.close();
+
+    } else {
+        // store variable values in data array to be written later
+
+        // temp
+        diagfile1_data[index*ndiag1  ] = t_in;
+        diagfile1_data[index*ndiag1+1] = T_max;
+        const Real coord_temp_max_y = coord_Tmax[1];
+        const Real coord_temp_max_z = (AMREX_SPACEDIM == 2) ? 0.0 : coord_Tmax[2];
+        diagfile1_data[index*ndiag1+2] = coord_Tmax[0];
+        diagfile1_data[index*ndiag1+3] = coord_temp_max_y;
+        diagfile1_data[index*ndiag1+4] = coord_temp_max_z;
+        const Real vel_temp_max_y = vel_Tmax[1];
+        const Real vel_temp_max_z = (AMREX_SPACEDIM == 2) ? 0.0 : vel_Tmax[2];
+        diagfile1_data[index*ndiag1+5] = vel_Tmax[0];
+        diagfile1_data[index*ndiag1+6] = vel_temp_max_y;
+        diagfile1_data[index*ndiag1+7] = vel_temp_max_z;
+        if (spherical) {
+            diagfile1_data[index*ndiag1+8] = Rloc_Tmax;
+            diagfile1_data[index*ndiag1+9] = vr_Tmax;
+            diagfile1_data[index*ndiag1+10] = T_center;
+        }
+
+        // enuc
+        diagfile2_data[index*ndiag2  ] = t_in;
+        diagfile2_data[index*ndiag2+1] = enuc_max;
+        const Real coord_enuc_y = coord_enucmax[1];
+        const Real coord_enuc_z = (AMREX_SPACEDIM == 2) ? 0.0 : coord_enucmax[2];
+        diagfile2_data[index*ndiag2+2] = coord_enucmax[0];
+        diagfile2_data[index*ndiag2+3] = coord_enuc_y;
+        diagfile2_data[index*ndiag2+4] = coord_enuc_z;
+        const Real vel_enuc_y = vel_enucmax[1];
+        const Real vel_enuc_z = (AMREX_SPACEDIM == 2) ? 0.0 : vel_enucmax[2];
+        diagfile2_data[index*ndiag2+5] = vel_enucmax[0];
+        diagfile2_data[index*ndiag2+6] = vel_enuc_y;
+        diagfile2_data[index*ndiag2+7] = vel_enuc_z;
+        diagfile2_data[index*ndiag2+8] = Rloc_enucmax;
+        diagfile2_data[index*ndiag2+9] = vr_enucmax;
+        diagfile2_data[index*ndiag2+10] = nuc_ener;
+
+        // vel
+        diagfile3_data[index*ndiag3  ] = t_in;
+        diagfile3_data[index*ndiag3+1] = U_max;
+        diagfile3_data[index*ndiag3+2] = Mach_max;
+        diagfile3_data[index*ndiag3+3] = kin_ener;
+        diagfile3_data[index*ndiag3+4] = grav_ener;
+        diagfile3_data[index*ndiag3+5] = int_ener;
+        if (spherical) {
+            diagfile3_data[index*ndiag3+6] = vel_center[0];
+            diagfile3_data[index*ndiag3+7] = vel_center[1];
+            diagfile3_data[index*ndiag3+8] = vel_center[2];
+        }
+        const int idt = spherical ? 9 : 6;
+        diagfile3_data[index*ndiag3+idt] = dt;
+
+        index += 1;
+    }
+
+    // the buffers are full -- write them out
+    if (index == diag_buf_size) {
+        WriteDiagFile(index);
+    }
 }
 
 // put together a vector of multifabs for writing
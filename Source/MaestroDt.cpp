@@ -494,6 +494,8 @@ Maestro::FirstDt ()
         // over
         MultiFab tmp(grids[lev], dmap[lev], 1, 0);
 
+        MultiFab* eos_cache_mf = EOSCacheMF(lev, sold[lev]);
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel reduction(min:dt_lev) reduction(max:umax_lev)
@@ -513,6 +515,8 @@ Maestro::FirstDt ()
                 const Array4<const Real> S_cc_arr = S_cc_old[lev].array(mfi);
                 const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
                 const Array4<const Real> gamma1bar_arr = gamma1bar_cart[lev].array(mfi);
+                const Array4<Real> eos_cache_arr = eos_cache_mf ?
+                    eos_cache_mf->array(mfi) : Array4<Real>();
 
                 const Real eps = 1.e-8;
                 const Real rho_min = 1.e-20;
@@ -535,7 +539,7 @@ Maestro::FirstDt ()
                     }
 
                     // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(eos_cache_arr, i, j, k, eos_state);
 
                     spd_arr(i,j,k) = eos_state.cs;
                 });
@@ -177,6 +177,42 @@ Maestro::EnthalpyAdvance (int which_step,
     // Compute fluxes
     //////////////////////////////////
 
+    // with fuse_scalar_update, the fluxes and the update below are done in
+    // a single pass, as for the species in DensityAdvance.  The force does
+    // not depend on the fluxes, so it is made first.
+    if (fuse_scalar_update && !spherical &&
+        enthalpy_pred_type != predict_hprime &&
+        (finest_level == 0 || reflux_type == 2)) {
+
+        for (int lev=0; lev<=finest_level; ++lev) {
+            scal_force[lev].setVal(0.,RhoH,1,1);
+        }
+
+        Addw0(umac, w0mac, -1.);
+        MakeRhoHForce(scal_force,0,thermal,umac,0,which_step);
+        Addw0(umac, w0mac, 1.);
+
+        Vector<MultiFab> p0_new_cart(finest_level+1);
+        for (int lev=0; lev<=finest_level; ++lev) {
+            p0_new_cart[lev].define(grids[lev], dmap[lev], 1, 1);
+        }
+
+        Put1dArrayOnCart(p0_new,p0_new_cart,0,0,bcs_f,0);
+
+        if (which_step == 1) {
+            UpdateRhoHFused(scalold, scalnew, sflux, sedge, umac,
+                            rho0_old, rho0_edge_old, rho0_old, rho0_edge_old,
+                            rhoh0_old, rhoh0_edge_old, rhoh0_old, rhoh0_edge_old,
+                            scal_force, p0_new_cart);
+        } else {
+            UpdateRhoHFused(scalold, scalnew, sflux, sedge, umac,
+                            rho0_old, rho0_edge_old, rho0_new, rho0_edge_new,
+                            rhoh0_old, rhoh0_edge_old, rhoh0_new, rhoh0_edge_new,
+                            scal_force, p0_new_cart);
+        }
+        return;
+    }
+
     // for which_step .eq. 1, we pass in only the old base state quantities
     // for which_step .eq. 2, we pass in the old and new for averaging within mkflux
     if (which_step == 1) {
@@ -28,6 +28,12 @@ Maestro::Evolve ()
             Regrid();
         }
 
+        // redistribute the burner work using the costs measured since the
+        // last balance
+        if (burner_lb_type > 0 && burner_lb_int > 0 && (istep-1) % burner_lb_int == 0 && istep != 1) {
+            LoadBalanceBurner();
+        }
+
         dtold = dt;
 
         // compute time step
@@ -73,6 +79,10 @@ Maestro::Evolve ()
             t_new = t_old + dt;
         }
 
+        // the diagnostics reductions from the previous step have been
+        // overlapping with EstDt; complete them now
+        FinishDiagFile(diag_index);
+
         // wallclock time
         Real start_total = ParallelDescriptor::second();
 
@@ -145,9 +155,13 @@ Maestro::Evolve ()
             WriteCheckPoint(istep);
         }
 
+        // publish an asynchronous checkpoint once it has been written
+        FinishCheckPoint(false);
+
         if ((diag_index == diag_buf_size || istep == max_step ||
             t_old >= stop_time) && (sum_per > 0.0 || sum_interval > 0)) {
             // write out any buffered diagnostic information
+            FinishDiagFile(diag_index);
             WriteDiagFile(diag_index);
         }
 
@@ -167,4 +181,11 @@ Maestro::Evolve ()
         gamma1bar_old.swap(gamma1bar_new);
         grav_cell_old.swap(grav_cell_new);
     }
+
+    // wait for any asynchronous checkpoint still being written
+    FinishCheckPoint();
+
+    if (scratch_pool_stats) {
+        scratch_pool.PrintStats("end of run");
+    }
 }
@@ -75,6 +75,10 @@ Maestro::Put1dArrayOnCart (int lev,
     const int nr_fine = base_geom.nr_fine;
     const int w0_interp_type_loc = w0_interp_type;
 
+    // use the radii stored by MakeRadiusCache if they are current for these grids
+    const bool use_cache = spherical && use_radius_cache &&
+        cell_cc_radius[lev].ok() && isMFIterSafe(s0_cart, cell_cc_radius[lev]);
+
     // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -101,6 +105,11 @@ Maestro::Put1dArrayOnCart (int lev,
 
             const Array4<const int> cc_to_r = cell_cc_to_r[lev].array(mfi);
 
+            Array4<const Real> radius_cc;
+            if (use_cache) {
+                radius_cc = cell_cc_radius[lev].array(mfi);
+            }
+
             if (use_exact_base_state) {
                 if (is_input_edge_centered) {
                     // we implemented three different ideas for computing s0_cart,
@@ -115,7 +124,7 @@ Maestro::Put1dArrayOnCart (int lev,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache ? radius_cc(i,j,k) : sqrt(x*x + y*y + z*z);
                         int index = cc_to_r(i,j,k);
 
                         Real rfac;
@@ -183,7 +192,7 @@ Maestro::Put1dArrayOnCart (int lev,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache ? radius_cc(i,j,k) : sqrt(x*x + y*y + z*z);
                         int index = cc_to_r(i,j,k);
 
                         Real s0_cart_val = s0_arr(0,index);
@@ -215,7 +224,7 @@ Maestro::Put1dArrayOnCart (int lev,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache ? radius_cc(i,j,k) : sqrt(x*x + y*y + z*z);
 
                         auto index = int(radius / drf);
                         Real rfac = (radius - Real(index) * drf) / drf;
@@ -280,7 +289,7 @@ Maestro::Put1dArrayOnCart (int lev,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache ? radius_cc(i,j,k) : sqrt(x*x + y*y + z*z);
                         auto index = int(radius / drf);
 
                         Real s0_cart_val = 0.0;
@@ -734,11 +743,17 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
     const auto center_p = center;
     const auto s0_arr = s0.const_array();
 
+    // the face radii are only cached when s0mac_interp_type > 1
+    const bool use_cache = use_radius_cache && s0mac_interp_type > 1;
+
     for (int lev=0; lev<=finest_level; ++lev) {
     
         const auto dx = geom[lev].CellSizeArray();
         const auto prob_lo = geom[lev].ProbLoArray();
 
+        const bool use_cache_lev = use_cache && face_radius[lev][0].ok() &&
+            isMFIterSafe(s0mac[lev][0], face_radius[lev][0]);
+
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -755,6 +770,13 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
             const Array4<Real> s0macz = s0mac[lev][2].array(mfi);
             const Array4<const Real> s0_cart_arr = s0_cart[lev].array(mfi);
 
+            Array4<const Real> radius_x, radius_y, radius_z;
+            if (use_cache_lev) {
+                radius_x = face_radius[lev][0].array(mfi);
+                radius_y = face_radius[lev][1].array(mfi);
+                radius_z = face_radius[lev][2].array(mfi);
+            }
+
             if (use_exact_base_state) {
                 // we currently have three different ideas for computing s0mac
                 // 1.  Interpolate s0 to cell centers, then average to edges
@@ -783,7 +805,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_x(i,j,k) : sqrt(x*x + y*y + z*z);
                         int index = round(radius*radius / (dx[0]*dx[0]) - 0.375);
                         // closest radial index to edge-centered point
 
@@ -819,7 +841,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_y(i,j,k) : sqrt(x*x + y*y + z*z);
                         int index = round(radius*radius / (dx[1]*dx[1]) - 0.375);
                         // closest radial index to edge-centered point
 
@@ -855,7 +877,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_z(i,j,k) : sqrt(x*x + y*y + z*z);
                         int index = round(radius*radius / (dx[2]*dx[2]) - 0.375);
                         // closest radial index to edge-centered point
 
@@ -893,7 +915,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_x(i,j,k) : sqrt(x*x + y*y + z*z);
                         int index = round(radius*radius / (dx[0]*dx[0]) - 0.375);
                         // closest radial index to edge-centered point
 
@@ -919,7 +941,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_y(i,j,k) : sqrt(x*x + y*y + z*z);
                         int index = round(radius*radius / (dx[1]*dx[1]) - 0.375);
                         // closest radial index to edge-centered point
 
@@ -945,7 +967,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_z(i,j,k) : sqrt(x*x + y*y + z*z);
                         int index = round(radius*radius / (dx[2]*dx[2]) - 0.375);
                         // closest radial index to edge-centered point
 
@@ -990,7 +1012,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_x(i,j,k) : sqrt(x*x + y*y + z*z);
                         auto index = int(radius / drf);
 
                         if (radius >= r_cc_loc(0,index)) {
@@ -1021,7 +1043,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_y(i,j,k) : sqrt(x*x + y*y + z*z);
                         auto index = int(radius / drf);
 
                         if (radius >= r_cc_loc(0,index)) {
@@ -1052,7 +1074,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_z(i,j,k) : sqrt(x*x + y*y + z*z);
                         auto index = int(radius / drf);
 
                         if (radius >= r_cc_loc(0,index)) {
@@ -1085,7 +1107,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_x(i,j,k) : sqrt(x*x + y*y + z*z);
                         auto index = int(radius / drf);
 
                         if (index == 0) {
@@ -1108,7 +1130,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_y(i,j,k) : sqrt(x*x + y*y + z*z);
                         auto index = int(radius / drf);
 
                         if (index == 0) {
@@ -1131,7 +1153,7 @@ Maestro::MakeS0mac (const BaseState<Real>& s0,
                         Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
                         Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
 
-                        Real radius = sqrt(x*x + y*y + z*z);
+                        Real radius = use_cache_lev ? radius_z(i,j,k) : sqrt(x*x + y*y + z*z);
                         auto index = int(radius / drf);
 
                         if (index == 0) {
@@ -1202,6 +1224,92 @@ Maestro::MakeNormal ()
     }
 }
 
+void
+Maestro::MakeRadiusCache ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeRadiusCache()", MakeRadiusCache);
+
+    // the radii only depend on the grids, so we store them once per regrid
+    // instead of recomputing the square roots every time a 1D array is
+    // mapped onto the Cartesian grid.  The face radii are only used when
+    // MakeS0mac interpolates directly to the faces (s0mac_interp_type > 1).
+
+    if (!spherical || !use_radius_cache) {
+        return;
+    }
+
+#if (AMREX_SPACEDIM == 3)
+    const auto& center_p = center;
+    const bool fill_faces = s0mac_interp_type > 1;
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+
+        const auto dx = geom[lev].CellSizeArray();
+        const auto prob_lo = geom[lev].ProbLoArray();
+
+        cell_cc_radius[lev].define(grids[lev], dmap[lev], 1, 0);
+        if (fill_faces) {
+            face_radius[lev][0].define(convert(grids[lev],nodal_flag_x), dmap[lev], 1, 1);
+            face_radius[lev][1].define(convert(grids[lev],nodal_flag_y), dmap[lev], 1, 1);
+            face_radius[lev][2].define(convert(grids[lev],nodal_flag_z), dmap[lev], 1, 1);
+        }
+
+        // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(cell_cc_radius[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+            const Box& tileBox = mfi.tilebox();
+            const Array4<Real> radius_cc = cell_cc_radius[lev].array(mfi);
+
+            AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
+                Real x = prob_lo[0] + (Real(i)+0.5) * dx[0] - center_p[0];
+                Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
+                Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
+
+                radius_cc(i,j,k) = sqrt(x*x + y*y + z*z);
+            });
+
+            if (fill_faces) {
+                const Box& xbx = mfi.grownnodaltilebox(0, 1);
+                const Box& ybx = mfi.grownnodaltilebox(1, 1);
+                const Box& zbx = mfi.grownnodaltilebox(2, 1);
+
+                const Array4<Real> radius_x = face_radius[lev][0].array(mfi);
+                const Array4<Real> radius_y = face_radius[lev][1].array(mfi);
+                const Array4<Real> radius_z = face_radius[lev][2].array(mfi);
+
+                AMREX_PARALLEL_FOR_3D(xbx, i, j, k, {
+                    Real x = prob_lo[0] + Real(i) * dx[0] - center_p[0];
+                    Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
+                    Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
+
+                    radius_x(i,j,k) = sqrt(x*x + y*y + z*z);
+                });
+
+                AMREX_PARALLEL_FOR_3D(ybx, i, j, k, {
+                    Real x = prob_lo[0] + (Real(i)+0.5) * dx[0] - center_p[0];
+                    Real y = prob_lo[1] + Real(j) * dx[1] - center_p[1];
+                    Real z = prob_lo[2] + (Real(k)+0.5) * dx[2] - center_p[2];
+
+                    radius_y(i,j,k) = sqrt(x*x + y*y + z*z);
+                });
+
+                AMREX_PARALLEL_FOR_3D(zbx, i, j, k, {
+                    Real x = prob_lo[0] + (Real(i)+0.5) * dx[0] - center_p[0];
+                    Real y = prob_lo[1] + (Real(j)+0.5) * dx[1] - center_p[1];
+                    Real z = prob_lo[2] + Real(k) * dx[2] - center_p[2];
+
+                    radius_z(i,j,k) = sqrt(x*x + y*y + z*z);
+                });
+            }
+        }
+    }
+#endif
+}
+
 
 void
 Maestro::PutDataOnFaces(const Vector<MultiFab>& s_cc,
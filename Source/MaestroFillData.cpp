@@ -39,6 +39,11 @@ Maestro::FillPatch (int lev, Real time, MultiFab& mf,
     Vector<BCRec> bcs{bcs_in.begin()+startbccomp,bcs_in.begin()+startbccomp+ncomp};
 
     if (lev == 0) {
+        // only one ghost cell exchange can be in flight on a MultiFab
+        if (async_fill.mf == &mf) {
+            FillPatchFinish();
+        }
+
         Vector<MultiFab*> smf;
         Vector<Real> stime;
         GetData(0, time, smf, stime, mf_old, mf_new);
@@ -78,6 +83,67 @@ Maestro::FillPatch (int lev, Real time, MultiFab& mf,
     }
 }
 
+// start filling the ghost cells of mf from its own valid data.
+// the finer levels are filled now; at level 0 the exchange between
+// boxes is left in flight for FillPatchFinish to complete
+void
+Maestro::FillPatchAsync (Real time,
+                         Vector<MultiFab>& mf,
+                         int comp, int ncomp, int startbccomp,
+                         const Vector<BCRec>& bcs_in, int variable_type)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FillPatchAsync()",FillPatchAsync);
+
+    // only one fill can be in flight
+    FillPatchFinish();
+
+    // the fine levels interpolate from the valid data of the coarser
+    // level, so they do not need the level 0 ghost cells
+    for (int lev=1; lev<=finest_level; ++lev) {
+        FillPatch(lev, time, mf[lev], mf, mf, comp, comp, ncomp,
+                  startbccomp, bcs_in, variable_type);
+    }
+
+    async_fill.mf = &mf[0];
+    async_fill.time = time;
+    async_fill.comp = comp;
+    async_fill.ncomp = ncomp;
+    async_fill.bcs.assign(bcs_in.begin()+startbccomp, bcs_in.begin()+startbccomp+ncomp);
+    async_fill.variable_type = variable_type;
+
+    mf[0].FillBoundary_nowait(comp, ncomp, geom[0].periodicity());
+}
+
+// complete the fill started by FillPatchAsync: wait for the ghost cells
+// from the other boxes, then fill the physical boundary ghost cells
+void
+Maestro::FillPatchFinish ()
+{
+    if (async_fill.mf == nullptr) {
+        return;
+    }
+
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FillPatchFinish()",FillPatchFinish);
+
+    MultiFab& mf = *async_fill.mf;
+
+    mf.FillBoundary_finish();
+
+    PhysBCFunctMaestro physbc;
+
+    if (async_fill.variable_type == 1) { // velocity
+        physbc.define(geom[0],async_fill.bcs,BndryFuncArrayMaestro(VelFill));
+    } else { // scalar
+        physbc.define(geom[0],async_fill.bcs,BndryFuncArrayMaestro(ScalarFill));
+    }
+
+    physbc(mf, async_fill.comp, async_fill.ncomp, mf.nGrowVect(), async_fill.time, 0);
+
+    async_fill.mf = nullptr;
+}
+
 // fill an entire multifab by interpolating from the coarser level
 // this comes into play when a new level of refinement appears
 // srccomp of the source component
@@ -120,6 +186,56 @@ Maestro::FillCoarsePatch (int lev, Real time, MultiFab& mf,
                           mapper, bcs, 0);
 }
 
+// fill the valid nodes of a nodal multifab on (possibly new) grids at level lev
+// from the nodal data in mf_in, copying from mf_in[lev] where the grids overlap
+// and interpolating from mf_in[lev-1] elsewhere.  The nodal data carried across
+// a regrid has no physical boundary ghost cells to fill.
+void
+Maestro::FillPatchNodal (int lev, MultiFab& mf, Vector<MultiFab>& mf_in)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FillPatchNodal()",FillPatchNodal);
+
+    const Real time = 0.;
+    const int ncomp = mf.nComp();
+    Vector<BCRec> bcs{bcs_f.begin(),bcs_f.begin()+ncomp};
+    PhysBCFunctNoOp physbc;
+
+    if (lev == 0) {
+        FillPatchSingleLevel(mf, IntVect::TheZeroVector(), time, {&mf_in[0]}, {time},
+                             0, 0, ncomp, geom[lev], physbc, 0);
+    } else {
+        Interpolater* mapper = &node_bilinear_interp;
+        FillPatchTwoLevels(mf, IntVect::TheZeroVector(), time,
+                           {&mf_in[lev-1]}, {time}, {&mf_in[lev]}, {time},
+                           0, 0, ncomp, geom[lev-1], geom[lev],
+                           physbc, 0, physbc, 0, refRatio(lev-1),
+                           mapper, bcs, 0);
+    }
+}
+
+// fill the valid nodes of a nodal multifab at a level that did NOT exist
+// before by interpolating from mf_in[lev-1]
+void
+Maestro::FillCoarsePatchNodal (int lev, MultiFab& mf, Vector<MultiFab>& mf_in)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::FillCoarsePatchNodal()",FillCoarsePatchNodal);
+
+    AMREX_ASSERT(lev > 0);
+
+    const Real time = 0.;
+    const int ncomp = mf.nComp();
+    Vector<BCRec> bcs{bcs_f.begin(),bcs_f.begin()+ncomp};
+    PhysBCFunctNoOp physbc;
+
+    Interpolater* mapper = &node_bilinear_interp;
+    InterpFromCoarseLevel(mf, IntVect::TheZeroVector(), time, mf_in[lev-1],
+                          0, 0, ncomp, geom[lev-1], geom[lev],
+                          physbc, 0, physbc, 0, refRatio(lev-1),
+                          mapper, bcs, 0);
+}
+
 // utility to copy in data from mf_old and/or mf_new into mf
 // if time=t_old we copy mf_old into mf
 // if time=t_new we copy mf_new into mf
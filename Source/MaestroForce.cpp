@@ -424,13 +424,14 @@ Maestro::ModifyScalForce(Vector<MultiFab>& scal_force,
 }
 
 
+template <bool psi_in_prediction>
 void
-Maestro::MakeRhoHForce(Vector<MultiFab>& scal_force,
-                       const int is_prediction,
-                       const Vector<MultiFab>& thermal,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac_cart,
-                       const int add_thermal,
-                       const int &which_step)
+Maestro::MakeRhoHForceT(Vector<MultiFab>& scal_force,
+                        const int is_prediction,
+                        const Vector<MultiFab>& thermal,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac_cart,
+                        const int add_thermal,
+                        const int &which_step)
 
 {
     // timer for profiling
@@ -452,8 +453,8 @@ Maestro::MakeRhoHForce(Vector<MultiFab>& scal_force,
         rho0.copy(rho0_old);
         p0.copy(p0_old);
     } else {
-        rho0.copy(0.5*(rho0_old + rho0_new));
-        p0.copy(0.5*(p0_old + p0_new));
+        rho0.lincomb(0.5, rho0_old, 0.5, rho0_new);
+        p0.lincomb(0.5, p0_old, 0.5, p0_new);
     }
 
     Vector<MultiFab> p0_cart(finest_level+1);
@@ -489,11 +490,9 @@ Maestro::MakeRhoHForce(Vector<MultiFab>& scal_force,
 
     Put1dArrayOnCart(grav, grav_cart, 0, 0, bcs_f, 0);
 
-    // constants in Fortran
-    const int enthalpy_pred_type_in = enthalpy_pred_type;
-    const int predict_h_const = predict_h;
-    const int predict_rhoh_const = predict_rhoh;
-    
+    // whether psi is in the force of a prediction depends only on
+    // enthalpy_pred_type, through the template parameter, so it is
+    // resolved at compile time
     for (int lev=0; lev<=finest_level; ++lev) {
 
         // Get cutoff coord
@@ -575,9 +574,7 @@ Maestro::MakeRhoHForce(Vector<MultiFab>& scal_force,
                     // (rho h)', but should be there if we are predicting h or rhoh
                     //
                     // If use_exact_base_state or average_base_state is on, psi is instead dpdt term
-                    if ((is_prediction == 1 && enthalpy_pred_type_in == predict_h_const) ||
-                        (is_prediction == 1 && enthalpy_pred_type_in == predict_rhoh_const) || 
-                        (!is_prediction)) {
+                    if ((is_prediction == 1 && psi_in_prediction) || (!is_prediction)) {
                         rhoh_force(i,j,k) += psicart(i,j,k);
                     }
 
@@ -600,9 +597,7 @@ Maestro::MakeRhoHForce(Vector<MultiFab>& scal_force,
 
                     rhoh_force(i,j,k) = divup - p0divu;
 
-                    if ((is_prediction == 1 && enthalpy_pred_type_in == predict_h_const) ||
-                        (is_prediction == 1 && enthalpy_pred_type_in == predict_rhoh_const) || 
-                        (is_prediction == 0)) {
+                    if ((is_prediction == 1 && psi_in_prediction) || (is_prediction == 0)) {
                     
                         rhoh_force(i,j,k) += psicart(i,j,k);
                     }
@@ -622,6 +617,32 @@ Maestro::MakeRhoHForce(Vector<MultiFab>& scal_force,
               RhoH, RhoH, 1, 0, bcs_f);
 }
 
+void
+Maestro::MakeRhoHForce(Vector<MultiFab>& scal_force,
+                       const int is_prediction,
+                       const Vector<MultiFab>& thermal,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac_cart,
+                       const int add_thermal,
+                       const int &which_step)
+{
+    (this->*make_rhoh_force)(scal_force, is_prediction, thermal, umac_cart,
+                             add_thermal, which_step);
+}
+
+void
+Maestro::SelectForceKernels ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SelectForceKernels()", SelectForceKernels);
+
+    // psi is in the force of a prediction of h or rhoh, but not of (rho h)'
+    if (enthalpy_pred_type == predict_h || enthalpy_pred_type == predict_rhoh) {
+        make_rhoh_force = &Maestro::MakeRhoHForceT<true>;
+    } else {
+        make_rhoh_force = &Maestro::MakeRhoHForceT<false>;
+    }
+}
+
 
 void
 Maestro::MakeTempForce(Vector<MultiFab>& temp_force,
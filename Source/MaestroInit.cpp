@@ -78,6 +78,8 @@ Maestro::Init ()
             if (spherical) {
                 normal[lev].define(grids[lev], dmap[lev], 3, 1);
                 cell_cc_to_r[lev].define(grids[lev], dmap[lev], 1, 0);
+                cell_cc_radius[lev].clear();
+                for (auto& f : face_radius[lev]) { f.clear(); }
             }
             pi[lev].define(convert(grids[lev],nodal_flag), dmap[lev], 1, 0); // nodal
 #ifdef SDC
@@ -121,6 +123,7 @@ Maestro::Init ()
     if (spherical) {
         MakeNormal();
         MakeCCtoRadii();
+        MakeRadiusCache();
     }
 #endif
 
@@ -309,12 +312,15 @@ Maestro::InitData ()
             // call eos with r,p as input to recompute T,h
             TfromRhoP(sold, p0_old, true);
 
-            // set rhoh0 to be the average
-            Average(sold, rhoh0_old, RhoH);
+            // set rhoh0 and tempbar to be the average in a single sweep
+            Vector<BaseState<Real>*> phibar = {&rhoh0_old, &tempbar};
+            Average(sold, phibar, {RhoH, Temp});
         }
 
-        // set tempbar to be the average
-        Average(sold, tempbar, Temp);
+        if (do_smallscale) {
+            // set tempbar to be the average
+            Average(sold, tempbar, Temp);
+        }
         tempbar_init.copy(tempbar);
     }
 
@@ -368,6 +374,9 @@ void Maestro::MakeNewLevelFromScratch (int lev, Real time, const BoxArray& ba,
     if (spherical) {
         normal      [lev].define(ba, dm, 3, 1);
         cell_cc_to_r[lev].define(ba, dm, 1, 0);
+        // the radius cache is (re)filled by MakeRadiusCache
+        cell_cc_radius[lev].clear();
+        for (auto& f : face_radius[lev]) { f.clear(); }
     }
 
     if (!spherical) {
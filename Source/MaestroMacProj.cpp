@@ -7,7 +7,9 @@ using namespace amrex;
 
 // umac enters with face-centered, time-centered Utilde^* and should leave with Utilde
 // macphi is the solution to the elliptic solve and
-//   enters as either zero, or the solution to the predictor MAC projection
+//   enters as either zero, or the solution to the predictor MAC projection.
+//   With warm_start_projections the predictor starts instead from the
+//   previous step's corrector solution, rescaled by dt
 // macrhs enters as beta0*(S-Sbar)
 // beta0 is a 1d cell-centered array
 void
@@ -124,17 +126,9 @@ Maestro::MacProj(Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
     }
 
     //
-    // Set up implicit solve using MLABecLaplacian class
+    // Set up implicit solve using the cached MLABecLaplacian
     //
-    LPInfo info;
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
-
-    // set boundaries for mlabec using velocity bc's
-    SetMacSolverBCs(mlabec);
+    MLABecLaplacian& mlabec = MacLinOp();
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &macphi[lev]);
@@ -149,6 +143,17 @@ Maestro::MacProj(Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
 
     // solve -div B grad phi = RHS
 
+    // start the predictor from the last corrector solution, which was
+    // saved divided by its dt; the ghost cells keep the boundary values
+    const bool warm_start = warm_start_projections && is_predictor == 1 &&
+        macphi_guess[0].ok();
+    if (warm_start) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Copy(macphi[lev], macphi_guess[lev], 0, 0, 1, 0);
+            macphi[lev].mult(dt, 0, 1, 0);
+        }
+    }
+
     // build an MLMG solver
     MLMG mac_mlmg(mlabec);
 
@@ -163,6 +168,25 @@ Maestro::MacProj(Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
     // solve for phi
     mac_mlmg.solve(GetVecOfPtrs(macphi), GetVecOfConstPtrs(solverrhs), mac_tol_rel, mac_tol_abs);
 
+    if (maestro_verbose > 0) {
+        Print() << "MAC projection " << (is_predictor == 1 ? "predictor" : "corrector")
+                << ": " << mac_mlmg.getNumIters() << " V-cycles"
+                << (warm_start ? " (warm start)" : "") << std::endl;
+    }
+
+    // keep the corrector solution as the next step's initial guess
+    if (warm_start_projections && is_predictor == 0) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            if (!macphi_guess[lev].ok() ||
+                macphi_guess[lev].boxArray() != grids[lev] ||
+                macphi_guess[lev].DistributionMap() != dmap[lev]) {
+                macphi_guess[lev].define(grids[lev], dmap[lev], 1, 0);
+            }
+            MultiFab::Copy(macphi_guess[lev], macphi[lev], 0, 0, 1, 0);
+            macphi_guess[lev].mult(1./dt, 0, 1, 0);
+        }
+    }
+
     // update velocity, beta0 * Utilde = beta0 * Utilde^* - B grad phi
 
     // storage for "-B grad_phi"
@@ -399,6 +423,29 @@ void Maestro::AvgFaceBcoeffsInv(Vector<std::array< MultiFab, AMREX_SPACEDIM > >&
 }
 
 // Set boundaries for MAC velocities
+MLABecLaplacian&
+Maestro::MacLinOp ()
+{
+    CheckLinOps();
+
+    if (!mac_linop) {
+        // timer for profiling
+        BL_PROFILE_VAR("Maestro::MacLinOp()", MacLinOp);
+
+        LPInfo info;
+        mac_linop.reset(new MLABecLaplacian(geom, grids, dmap, info));
+
+        // order of stencil
+        int linop_maxorder = 2;
+        mac_linop->setMaxOrder(linop_maxorder);
+
+        // set boundaries for mlabec using velocity bc's
+        SetMacSolverBCs(*mac_linop);
+    }
+
+    return *mac_linop;
+}
+
 void Maestro::SetMacSolverBCs(MLABecLaplacian& mlabec)
 {
     // timer for profiling
@@ -1,358 +1,424 @@
-
 #include <Maestro.H>
 #include <Maestro_F.H>
 
 using namespace amrex;
 
+namespace
+{
+    // resize a per-thread scratch fab to cover bx, keeping the memory
+    // alive (through an Elixir) until any kernels using it have finished
+    void ResizeScratch (FArrayBox& fab, const Box& bx, int ncomp,
+                        Vector<Elixir>& elixirs)
+    {
+        fab.resize(bx, ncomp);
+        elixirs.push_back(fab.elixir());
+    }
+}
+
+Box
+Maestro::EdgeScalFaceBox (const Box& bx, const Box& vbx, int dir)
+{
+    Box fbx = amrex::surroundingNodes(bx, dir);
+    if (bx.bigEnd(dir) < vbx.bigEnd(dir)) {
+        fbx.growHi(dir, -1);
+    }
+    return fbx;
+}
+
+BoxList
+Maestro::EdgeScalParts (const MFIter& mfi, int ng_scal, bool split_tiles, int pass)
+{
+    // the tile, in one or two parts: in the first of two passes, the cells
+    // whose stencil reads no ghost cells of the state; in the second, the
+    // shell around them
+    const Box& tilebx = mfi.tilebox();
+    const Box& inner = tilebx & amrex::grow(mfi.validbox(), -ng_scal);
+
+    BoxList parts;
+    if (!split_tiles) {
+        parts.push_back(tilebx);
+    } else if (pass == 0) {
+        if (inner.ok()) {
+            parts.push_back(inner);
+        }
+    } else {
+        parts = inner.ok() ? amrex::boxDiff(tilebx, inner) : BoxList(tilebx);
+    }
+    return parts;
+}
+
 void
 Maestro::MakeEdgeScal (Vector<MultiFab>& state,
                        Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
                        Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
                        Vector<MultiFab>& force,
                        int is_vel, const Vector<BCRec>& bcs, int nbccomp,
-                       int start_scomp, int start_bccomp, int num_comp, int is_conservative)
+                       int start_scomp, int start_bccomp, int num_comp, int is_conservative,
+                       bool fuse_comp)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScal()", MakeEdgeScal);
 
     for (int lev=0; lev<=finest_level; ++lev) {
 
-        // Get the index space and grid spacing of the domain
-        const Box& domainBox = geom[lev].Domain();
-        const auto dx = geom[lev].CellSizeArray();
-
         // get references to the MultiFabs at level lev
         const MultiFab& scal_mf = state[lev];
+        const int ng_scal = scal_mf.nGrow();
 
-        MultiFab Ip, Im, Ipf, Imf;
-        Ip.define(grids[lev],dmap[lev],AMREX_SPACEDIM,1);
-        Im.define(grids[lev],dmap[lev],AMREX_SPACEDIM,1);
-        Ipf.define(grids[lev],dmap[lev],AMREX_SPACEDIM,1);
-        Imf.define(grids[lev],dmap[lev],AMREX_SPACEDIM,1);
-        
-        MultiFab slx, srx, simhx;
-        slx.define(grids[lev],dmap[lev],1,1);
-        srx.define(grids[lev],dmap[lev],1,1);
-        simhx.define(grids[lev],dmap[lev],1,1);
-
-        MultiFab sly, sry, simhy;
-        sly.define(grids[lev],dmap[lev],1,1);
-        sry.define(grids[lev],dmap[lev],1,1);
-        simhy.define(grids[lev],dmap[lev],1,1);
-
-        slx.setVal(0.);
-        srx.setVal(0.);
-        simhx.setVal(0.);
-        sly.setVal(0.);
-        sry.setVal(0.);
-        simhy.setVal(0.);
-
-#if (AMREX_SPACEDIM == 3)
+        // If the ghost cells of the state are still being exchanged (see
+        // FillPatchAsync), each tile is split in two.  The cells at least
+        // ng_scal cells inside the valid box only read valid data and are
+        // done first; the shell of cells nearer the box boundary is done
+        // once the exchange has completed.
+        const bool split_tiles = async_fill.mf == &state[lev];
 
-        MultiFab slopez, divu;
-        slopez.define(grids[lev],dmap[lev],1,1);
-        divu.define(grids[lev],dmap[lev],1,1);
-
-        MultiFab slz, srz, simhz;
-        slz.define(grids[lev],dmap[lev],1,1);
-        srz.define(grids[lev],dmap[lev],1,1);
-        simhz.define(grids[lev],dmap[lev],1,1);
-
-        MultiFab simhxy, simhxz, simhyx, simhyz, simhzx, simhzy;
-        simhxy.define(grids[lev],dmap[lev],1,1);
-        simhxz.define(grids[lev],dmap[lev],1,1);
-        simhyx.define(grids[lev],dmap[lev],1,1);
-        simhyz.define(grids[lev],dmap[lev],1,1);
-        simhzx.define(grids[lev],dmap[lev],1,1);
-        simhzy.define(grids[lev],dmap[lev],1,1);
-
-        slx.setVal(0.);
-        srx.setVal(0.);
-        simhx.setVal(0.);
-        sly.setVal(0.);
-        sry.setVal(0.);
-        simhy.setVal(0.);
-        slz.setVal(0.);
-        srz.setVal(0.);
-        simhz.setVal(0.);
-
-        simhxy.setVal(0.);
-        simhxz.setVal(0.);
-        simhyx.setVal(0.);
-        simhyz.setVal(0.);
-        simhzx.setVal(0.);
-        simhzy.setVal(0.);
-#endif
-
-        // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
-#if (AMREX_SPACEDIM == 2)
+        for (int pass = 0; pass < (split_tiles ? 2 : 1); ++pass) {
 
-        Vector<MultiFab> vec_scal_mf(num_comp);
-        for (int comp=0; comp < num_comp; ++comp) {
-            vec_scal_mf[comp].define(grids[lev],dmap[lev],1,scal_mf.nGrow());
+            if (pass == 1) {
+                FillPatchFinish();
+            }
 
-            MultiFab::Copy(vec_scal_mf[comp], scal_mf, start_scomp+comp, 0, 1, scal_mf.nGrow());
-        }
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-        for ( MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+            {
+                EdgeScalScratch scratch;
 
-            // Get the index space of the valid region
-            const Box& tileBox = mfi.tilebox();
-            const Box& obx = amrex::grow(tileBox, 1);
+                for ( MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
 
-            // Be careful to pass in comp+1 for fortran indexing
-            for (int scomp = start_scomp; scomp < start_scomp + num_comp; ++scomp) {
+                    const BoxList& parts = EdgeScalParts(mfi, ng_scal, split_tiles, pass);
 
-                int vcomp = scomp - start_scomp;
-                int bccomp = start_bccomp + scomp - start_scomp;
+                    const std::array< Array4<Real>, AMREX_SPACEDIM > sedge_arr {{
+                        AMREX_D_DECL(sedge[lev][0].array(mfi),
+                                     sedge[lev][1].array(mfi),
+                                     sedge[lev][2].array(mfi)) }};
 
-                Array4<Real> const scal_arr = state[lev].array(mfi);
+                    for (const Box& bx : parts) {
+                        MakeEdgeScalBox(mfi, bx, mfi.validbox(), lev, state[lev], sedge_arr,
+                                        umac[lev], force[lev], is_vel, bcs,
+                                        start_scomp, start_bccomp, num_comp,
+                                        is_conservative, fuse_comp, scratch);
+                    }
+                } // end MFIter loop
+            } // end omp parallel region
+        } // end loop over passes
+    } // end loop over levels
 
-                Array4<Real> const umac_arr = umac[lev][0].array(mfi);
-                Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
+    // We use edge_restriction for the output velocity if is_vel == 1
+    // we do not use edge_restriction for scalars because instead we will use
+    // reflux on the fluxes in make_flux.
+    if (is_vel == 1) {
+        if (reflux_type == 1 || reflux_type == 2) {
+            AverageDownFaces(sedge);
+        }
+    }
+}
 
-                Array4<Real> const slx_arr = slx.array(mfi);
-                Array4<Real> const srx_arr = srx.array(mfi);
-                Array4<Real> const sly_arr = sly.array(mfi);
-                Array4<Real> const sry_arr = sry.array(mfi);
+void
+Maestro::MakeEdgeScalBox (const MFIter& mfi, const Box& bx, const Box& vbx, int lev,
+                          MultiFab& state,
+                          const std::array< Array4<Real>, AMREX_SPACEDIM >& sedge,
+                          std::array< MultiFab, AMREX_SPACEDIM >& umac,
+                          MultiFab& force,
+                          int is_vel, const Vector<BCRec>& bcs,
+                          int start_scomp, int start_bccomp, int num_comp, int is_conservative,
+                          bool fuse_comp, EdgeScalScratch& scratch)
+{
+    // number of components each kernel works on at once.  The fused
+    // kernels share the boundary conditions of the first component, so we
+    // only fuse if all the components have the same boundary conditions
+    int ncomp_fused = 1;
+    if (fuse_comp) {
+        bool same_bcs = true;
+        for (int n = 1; n < num_comp; ++n) {
+            same_bcs = same_bcs && (bcs[start_bccomp+n] == bcs[start_bccomp]);
+        }
+        if (same_bcs) {
+            ncomp_fused = num_comp;
+        }
+    }
 
-                Array4<Real> const simhx_arr = simhx.array(mfi);
-                Array4<Real> const simhy_arr = simhy.array(mfi);
+    // Get the index space and grid spacing of the domain
+    const Box& domainBox = geom[lev].Domain();
+    const auto dx = geom[lev].CellSizeArray();
+
+    const int ng_scal = state.nGrow();
+
+    // The slopes/parabolic profiles, predicted interface states and
+    // transverse terms are only needed while a box is being worked on, so
+    // each thread keeps them in the FArrayBoxes of its scratch, sized to
+    // the box grown by one cell, instead of in level-wide MultiFabs.  All
+    // the stages for all the components are done for one box before
+    // moving on.  Component n of a group of ncomp_fused components is
+    // stored in component n of the scratch (component d*ncomp_fused+n of
+    // Ip/Im for direction d).
+    FArrayBox& Ip = scratch.Ip;
+    FArrayBox& Im = scratch.Im;
+    FArrayBox& Ipf = scratch.Ipf;
+    FArrayBox& Imf = scratch.Imf;
+    FArrayBox& slx = scratch.slx;
+    FArrayBox& srx = scratch.srx;
+    FArrayBox& simhx = scratch.simhx;
+    FArrayBox& sly = scratch.sly;
+    FArrayBox& sry = scratch.sry;
+    FArrayBox& simhy = scratch.simhy;
+#if (AMREX_SPACEDIM == 3)
+    FArrayBox& slopez = scratch.slopez;
+    FArrayBox& divu = scratch.divu;
+    FArrayBox& slz = scratch.slz;
+    FArrayBox& srz = scratch.srz;
+    FArrayBox& simhz = scratch.simhz;
+    FArrayBox& simhxy = scratch.simhxy;
+    FArrayBox& simhxz = scratch.simhxz;
+    FArrayBox& simhyx = scratch.simhyx;
+    FArrayBox& simhyz = scratch.simhyz;
+    FArrayBox& simhzx = scratch.simhzx;
+    FArrayBox& simhzy = scratch.simhzy;
+#endif
+    FArrayBox& scal_comp = scratch.scal_comp;
+    Vector<Elixir>& elixirs = scratch.elixirs;
 
-                if (ppm_type == 0) {
-                    // we're going to reuse Ip here as slopex and Im as slopey
-                    // as they have the correct number of ghost zones
 
-                    // x-direction
-                    Slopex(obx, vec_scal_mf[vcomp].array(mfi), 
-                           Ip.array(mfi), 
-                           domainBox, bcs, 
-                           1,bccomp);
+    const Box& obx = amrex::grow(bx, 1);
+    const Box& gbx = amrex::grow(bx, ng_scal);
 
-                    // y-direction
-                    Slopey(obx, vec_scal_mf[vcomp].array(mfi), 
-                           Im.array(mfi), 
-                           domainBox, bcs, 
-                           1,bccomp);
+    elixirs.clear();
 
-                } else {
+    ResizeScratch(Ip, obx, AMREX_SPACEDIM*ncomp_fused, elixirs);
+    ResizeScratch(Im, obx, AMREX_SPACEDIM*ncomp_fused, elixirs);
+    ResizeScratch(Ipf, obx, AMREX_SPACEDIM*ncomp_fused, elixirs);
+    ResizeScratch(Imf, obx, AMREX_SPACEDIM*ncomp_fused, elixirs);
 
-                    PPM(obx, scal_arr, 
-                        umac_arr, vmac_arr, 
-                        Ip.array(mfi), Im.array(mfi), 
-                        domainBox, bcs, dx, 
-                        true, scomp, bccomp);
+    ResizeScratch(slx, obx, ncomp_fused, elixirs);
+    ResizeScratch(srx, obx, ncomp_fused, elixirs);
+    ResizeScratch(simhx, obx, ncomp_fused, elixirs);
+    ResizeScratch(sly, obx, ncomp_fused, elixirs);
+    ResizeScratch(sry, obx, ncomp_fused, elixirs);
+    ResizeScratch(simhy, obx, ncomp_fused, elixirs);
 
-                    if (ppm_trace_forces == 1) {
+    slx.setVal<RunOn::Device>(0.);
+    srx.setVal<RunOn::Device>(0.);
+    simhx.setVal<RunOn::Device>(0.);
+    sly.setVal<RunOn::Device>(0.);
+    sry.setVal<RunOn::Device>(0.);
+    simhy.setVal<RunOn::Device>(0.);
 
-                        PPM(obx, force[lev].array(mfi), 
-                            umac_arr, vmac_arr, 
-                            Ipf.array(mfi), Imf.array(mfi), 
-                            domainBox, bcs, dx, 
-                            true, scomp, bccomp);
-                    }
-                }
+#if (AMREX_SPACEDIM == 3)
+    ResizeScratch(slopez, obx, ncomp_fused, elixirs);
+    ResizeScratch(divu, obx, 1, elixirs);
+
+    ResizeScratch(slz, obx, ncomp_fused, elixirs);
+    ResizeScratch(srz, obx, ncomp_fused, elixirs);
+    ResizeScratch(simhz, obx, ncomp_fused, elixirs);
+
+    ResizeScratch(simhxy, obx, ncomp_fused, elixirs);
+    ResizeScratch(simhxz, obx, ncomp_fused, elixirs);
+    ResizeScratch(simhyx, obx, ncomp_fused, elixirs);
+    ResizeScratch(simhyz, obx, ncomp_fused, elixirs);
+    ResizeScratch(simhzx, obx, ncomp_fused, elixirs);
+    ResizeScratch(simhzy, obx, ncomp_fused, elixirs);
+
+    slz.setVal<RunOn::Device>(0.);
+    srz.setVal<RunOn::Device>(0.);
+    simhz.setVal<RunOn::Device>(0.);
+
+    simhxy.setVal<RunOn::Device>(0.);
+    simhxz.setVal<RunOn::Device>(0.);
+    simhyx.setVal<RunOn::Device>(0.);
+    simhyz.setVal<RunOn::Device>(0.);
+    simhzx.setVal<RunOn::Device>(0.);
+    simhzy.setVal<RunOn::Device>(0.);
+#endif
 
-                // Create s_{\i-\half\e_x}^x, etc.
-
-                MakeEdgeScalPredictor(mfi, slx_arr, srx_arr,
-                                      sly_arr, sry_arr,
-                                      scal_arr, 
-                                      Ip.array(mfi), Im.array(mfi), 
-                                      umac_arr, vmac_arr, 
-                                      simhx_arr, simhy_arr, 
-                                      domainBox, bcs, dx,
-                                      scomp, bccomp, is_vel);
-
-                Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
-                Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
-
-                // Create sedgelx, etc.
-
-                MakeEdgeScalEdges(mfi, slx_arr, srx_arr,
-                                  sly_arr, sry_arr,
-                                  scal_arr, 
-                                  sedgex_arr, sedgey_arr, 
-                                  force[lev].array(mfi),
-                                  umac_arr, vmac_arr, 
-                                  Ipf.array(mfi), Imf.array(mfi),
-                                  simhx_arr, simhy_arr, 
-                                  domainBox, bcs, dx,
-                                  scomp, bccomp, 
-                                  is_vel, is_conservative);
-            } // end loop over components
-        } // end MFIter loop
+    if (ppm_type == 0) {
+        ResizeScratch(scal_comp, gbx, ncomp_fused, elixirs);
+    }
 
-#elif (AMREX_SPACEDIM == 3)
+    Array4<Real> const scal_arr = state.array(mfi);
 
-        Vector<MultiFab> vec_scal_mf(num_comp);
-        for (int comp=0; comp < num_comp; ++comp) {
-            vec_scal_mf[comp].define(grids[lev],dmap[lev],1,scal_mf.nGrow());
-            vec_scal_mf[comp].setVal(0.);
+    Array4<Real> const umac_arr = umac[0].array(mfi);
+    Array4<Real> const vmac_arr = umac[1].array(mfi);
+#if (AMREX_SPACEDIM == 3)
+    Array4<Real> const wmac_arr = umac[2].array(mfi);
+#endif
 
-            MultiFab::Copy(vec_scal_mf[comp], scal_mf, start_scomp+comp, 0, 1, scal_mf.nGrow());
-        }
+    Array4<Real> const Ip_arr = Ip.array();
+    Array4<Real> const Im_arr = Im.array();
+    Array4<Real> const Ipf_arr = Ipf.array();
+    Array4<Real> const Imf_arr = Imf.array();
 
-        // Be careful to pass in comp+1 for fortran indexing
-        for (int scomp = start_scomp; scomp < start_scomp + num_comp; ++scomp) {
+    Array4<Real> const slx_arr = slx.array();
+    Array4<Real> const srx_arr = srx.array();
+    Array4<Real> const sly_arr = sly.array();
+    Array4<Real> const sry_arr = sry.array();
 
-            int vcomp = scomp - start_scomp;
-            int bccomp = start_bccomp + scomp - start_scomp;
+    Array4<Real> const simhx_arr = simhx.array();
+    Array4<Real> const simhy_arr = simhy.array();
 
-#ifdef _OPENMP
-#pragma omp parallel
+#if (AMREX_SPACEDIM == 3)
+    Array4<Real> const slopez_arr = slopez.array();
+    Array4<Real> const divu_arr = divu.array();
+
+    Array4<Real> const slz_arr = slz.array();
+    Array4<Real> const srz_arr = srz.array();
+    Array4<Real> const simhz_arr = simhz.array();
+
+    Array4<Real> const simhxy_arr = simhxy.array();
+    Array4<Real> const simhxz_arr = simhxz.array();
+    Array4<Real> const simhyx_arr = simhyx.array();
+    Array4<Real> const simhyz_arr = simhyz.array();
+    Array4<Real> const simhzx_arr = simhzx.array();
+    Array4<Real> const simhzy_arr = simhzy.array();
+
+    // make divu
+    if (is_conservative) {
+        MakeDivU(obx, divu_arr,
+                 umac_arr, vmac_arr, wmac_arr, dx);
+    }
 #endif
-            for ( MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
 
-                // Get the index space of the valid region
-                const Box& tileBox = mfi.tilebox();
-                const Box& obx = amrex::grow(tileBox, 1);
+    Array4<Real> const sedgex_arr = sedge[0];
+    Array4<Real> const sedgey_arr = sedge[1];
+#if (AMREX_SPACEDIM == 3)
+    Array4<Real> const sedgez_arr = sedge[2];
+#endif
 
-                Array4<Real> const umac_arr = umac[lev][0].array(mfi);
-                Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
-                Array4<Real> const wmac_arr = umac[lev][2].array(mfi);
+    // Be careful to pass in comp+1 for fortran indexing
+    for (int scomp = start_scomp; scomp < start_scomp + num_comp; scomp += ncomp_fused) {
 
-                // make divu 
-                if (is_conservative) {
-                    MakeDivU(obx, divu.array(mfi), 
-                             umac_arr, vmac_arr, wmac_arr, dx);
-                }
-                          
-                if (ppm_type == 0) {
-                    // we're going to reuse Ip here as slopex and Im as slopey
-                    // as they have the correct number of ghost zones
-
-                    // x-direction
-                    Slopex(obx, vec_scal_mf[vcomp].array(mfi), 
-                           Ip.array(mfi), 
-                           domainBox, bcs, 
-                           1,bccomp);
-
-                    // y-direction
-                    Slopey(obx, vec_scal_mf[vcomp].array(mfi), 
-                           Im.array(mfi), 
-                           domainBox, bcs, 
-                           1,bccomp);
-
-                    // z-direction
-                    Slopez(obx, vec_scal_mf[vcomp].array(mfi), 
-                           slopez.array(mfi), 
-                           domainBox, bcs, 
-                           1,bccomp);
+        int bccomp = start_bccomp + scomp - start_scomp;
 
-                } else {
+        if (ppm_type == 0) {
+            // we're going to reuse Ip here as slopex and Im as slopey
+            // as they have the correct number of ghost zones
 
-                    PPM(obx, state[lev].array(mfi), 
-                        umac_arr, vmac_arr, wmac_arr,
-                        Ip.array(mfi), Im.array(mfi), 
-                        domainBox, bcs, dx, 
-                        true, scomp, bccomp);
+            scal_comp.copy<RunOn::Device>(state[mfi], gbx, scomp, gbx, 0, ncomp_fused);
+            Array4<Real> const scal_comp_arr = scal_comp.array();
 
-                    if (ppm_trace_forces == 1) {
+            // x-direction
+            Slopex(obx, scal_comp_arr,
+                   Ip_arr,
+                   domainBox, bcs,
+                   ncomp_fused,bccomp);
 
-                        PPM(obx, force[lev].array(mfi), 
-                            umac_arr, vmac_arr, wmac_arr,
-                            Ipf.array(mfi), Imf.array(mfi), 
-                            domainBox, bcs, dx, 
-                            true, scomp, bccomp);
-                    }
-                }
-            }
+            // y-direction
+            Slopey(obx, scal_comp_arr,
+                   Im_arr,
+                   domainBox, bcs,
+                   ncomp_fused,bccomp);
 
-#ifdef _OPENMP
-#pragma omp parallel
+#if (AMREX_SPACEDIM == 3)
+            // z-direction
+            Slopez(obx, scal_comp_arr,
+                   slopez_arr,
+                   domainBox, bcs,
+                   ncomp_fused,bccomp);
 #endif
-            for ( MFIter mfi(scal_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
-
-                Array4<Real> const scal_arr = state[lev].array(mfi);
-
-                Array4<Real> const umac_arr = umac[lev][0].array(mfi);
-                Array4<Real> const vmac_arr = umac[lev][1].array(mfi);
-                Array4<Real> const wmac_arr = umac[lev][2].array(mfi);
-
-                Array4<Real> const slx_arr = slx.array(mfi);
-                Array4<Real> const srx_arr = srx.array(mfi);
-                Array4<Real> const sly_arr = sly.array(mfi);
-                Array4<Real> const sry_arr = sry.array(mfi);
-                Array4<Real> const slz_arr = slz.array(mfi);
-                Array4<Real> const srz_arr = srz.array(mfi);
-
-                Array4<Real> const simhx_arr = simhx.array(mfi);
-                Array4<Real> const simhy_arr = simhy.array(mfi);
-                Array4<Real> const simhz_arr = simhz.array(mfi);
-
-                // Create s_{\i-\half\e_x}^x, etc.
-
-                MakeEdgeScalPredictor(mfi, slx_arr, srx_arr,
-                                      sly_arr, sry_arr,
-                                      slz_arr, srz_arr,
-                                      scal_arr, 
-                                      Ip.array(mfi), Im.array(mfi), 
-                                      slopez.array(mfi),
-                                      umac_arr, vmac_arr, wmac_arr,
-                                      simhx_arr, simhy_arr, simhz_arr,
-                                      domainBox, bcs, dx,
-                                      scomp, bccomp, is_vel);
-
-                Array4<Real> const simhxy_arr = simhxy.array(mfi);
-                Array4<Real> const simhxz_arr = simhxz.array(mfi);
-                Array4<Real> const simhyx_arr = simhyx.array(mfi);
-                Array4<Real> const simhyz_arr = simhyz.array(mfi);
-                Array4<Real> const simhzx_arr = simhzx.array(mfi);
-                Array4<Real> const simhzy_arr = simhzy.array(mfi);
-
-                // Create transverse terms, s_{\i-\half\e_x}^{x|y}, etc.
-
-                MakeEdgeScalTransverse(mfi, slx_arr, srx_arr,
-                                       sly_arr, sry_arr,
-                                       slz_arr, srz_arr,
-                                       scal_arr, divu.array(mfi),
-                                       umac_arr, vmac_arr, wmac_arr,
-                                       simhx_arr, simhy_arr, simhz_arr,
-                                       simhxy_arr, simhxz_arr, simhyx_arr,
-                                       simhyz_arr, simhzx_arr, simhzy_arr,
-                                       domainBox, bcs, dx,
-                                       scomp, bccomp, 
-                                       is_vel, is_conservative);
-
-                Array4<Real> const sedgex_arr = sedge[lev][0].array(mfi);
-                Array4<Real> const sedgey_arr = sedge[lev][1].array(mfi);
-                Array4<Real> const sedgez_arr = sedge[lev][2].array(mfi);
-
-                // Create sedgelx, etc.
-
-                MakeEdgeScalEdges(mfi, slx_arr, srx_arr,
-                                  sly_arr, sry_arr,
-                                  slz_arr, srz_arr, scal_arr, 
-                                  sedgex_arr, sedgey_arr, sedgez_arr,
-                                  force[lev].array(mfi),
-                                  umac_arr, vmac_arr, wmac_arr,
-                                  Ipf.array(mfi), Imf.array(mfi),
-                                  simhxy_arr, simhxz_arr, simhyx_arr,
-                                  simhyz_arr, simhzx_arr, simhzy_arr,
-                                  domainBox, bcs, dx,
-                                  scomp, bccomp, 
-                                  is_vel, is_conservative);
-            } // end MFIter loop
-        } // end loop over components
+
+        } else {
+
+            PPM(obx, scal_arr,
+#if (AMREX_SPACEDIM == 2)
+                umac_arr, vmac_arr,
+#else
+                umac_arr, vmac_arr, wmac_arr,
 #endif
-    } // end loop over levels
+                Ip_arr, Im_arr,
+                domainBox, bcs, dx,
+                true, scomp, bccomp, ncomp_fused);
 
-    // We use edge_restriction for the output velocity if is_vel == 1
-    // we do not use edge_restriction for scalars because instead we will use
-    // reflux on the fluxes in make_flux.
-    if (is_vel == 1) {
-        if (reflux_type == 1 || reflux_type == 2) {
-            AverageDownFaces(sedge);
+            if (ppm_trace_forces == 1) {
+
+                PPM(obx, force.array(mfi),
+#if (AMREX_SPACEDIM == 2)
+                    umac_arr, vmac_arr,
+#else
+                    umac_arr, vmac_arr, wmac_arr,
+#endif
+                    Ipf_arr, Imf_arr,
+                    domainBox, bcs, dx,
+                    true, scomp, bccomp, ncomp_fused);
+            }
         }
-    }
+
+#if (AMREX_SPACEDIM == 2)
+
+        // Create s_{\i-\half\e_x}^x, etc.
+
+        (this->*make_edge_scal_predictor)(bx, slx_arr, srx_arr,
+                                          sly_arr, sry_arr,
+                                          scal_arr,
+                                          Ip_arr, Im_arr,
+                                          umac_arr, vmac_arr,
+                                          simhx_arr, simhy_arr,
+                                          domainBox, bcs, dx,
+                                          scomp, bccomp, ncomp_fused, is_vel);
+
+        // Create sedgelx, etc.
+
+        MakeEdgeScalEdges(bx, vbx, slx_arr, srx_arr,
+                          sly_arr, sry_arr,
+                          scal_arr,
+                          sedgex_arr, sedgey_arr,
+                          force.array(mfi),
+                          umac_arr, vmac_arr,
+                          Ipf_arr, Imf_arr,
+                          simhx_arr, simhy_arr,
+                          domainBox, bcs, dx,
+                          scomp, bccomp, ncomp_fused,
+                          is_vel, is_conservative);
+
+#elif (AMREX_SPACEDIM == 3)
+
+        // Create s_{\i-\half\e_x}^x, etc.
+
+        (this->*make_edge_scal_predictor)(bx, slx_arr, srx_arr,
+                                          sly_arr, sry_arr,
+                                          slz_arr, srz_arr,
+                                          scal_arr,
+                                          Ip_arr, Im_arr,
+                                          slopez_arr,
+                                          umac_arr, vmac_arr, wmac_arr,
+                                          simhx_arr, simhy_arr, simhz_arr,
+                                          domainBox, bcs, dx,
+                                          scomp, bccomp, ncomp_fused, is_vel);
+
+        // Create transverse terms, s_{\i-\half\e_x}^{x|y}, etc.
+
+        MakeEdgeScalTransverse(bx, slx_arr, srx_arr,
+                               sly_arr, sry_arr,
+                               slz_arr, srz_arr,
+                               scal_arr, divu_arr,
+                               umac_arr, vmac_arr, wmac_arr,
+                               simhx_arr, simhy_arr, simhz_arr,
+                               simhxy_arr, simhxz_arr, simhyx_arr,
+                               simhyz_arr, simhzx_arr, simhzy_arr,
+                               domainBox, bcs, dx,
+                               scomp, bccomp, ncomp_fused,
+                               is_vel, is_conservative);
+
+        // Create sedgelx, etc.
+
+        MakeEdgeScalEdges(bx, vbx, slx_arr, srx_arr,
+                          sly_arr, sry_arr,
+                          slz_arr, srz_arr, scal_arr,
+                          sedgex_arr, sedgey_arr, sedgez_arr,
+                          force.array(mfi),
+                          umac_arr, vmac_arr, wmac_arr,
+                          Ipf_arr, Imf_arr,
+                          simhxy_arr, simhxz_arr, simhyx_arr,
+                          simhyz_arr, simhzx_arr, simhzy_arr,
+                          domainBox, bcs, dx,
+                          scomp, bccomp, ncomp_fused,
+                          is_vel, is_conservative);
+#endif
+    } // end loop over components
 }
 
 #if (AMREX_SPACEDIM == 2)
 
-void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
+template <int ppm>
+void Maestro::MakeEdgeScalPredictor(const Box& tileBox,
                                     Array4<Real> const slx,
                                     Array4<Real> const srx,
                                     Array4<Real> const sly,
@@ -367,7 +433,7 @@ void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
                                     const Box& domainBox,
                                     const Vector<BCRec>& bcs,
                                     const amrex::GpuArray<Real,AMREX_SPACEDIM> dx,
-                                    int comp, int bccomp, bool is_vel)
+                                    int start_comp, int bccomp, int ncomp, bool is_vel)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScalPredictor()",MakeEdgeScalPredictor);
@@ -376,7 +442,9 @@ void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
     // Create s_{\i-\half\e_x}^x, etc.
     ///////////////////////////////////////
 
-    const Real ppm_type_local = ppm_type;
+    // ppm_type is a template parameter, so the tests of it in the kernels
+    // below are resolved at compile time
+    constexpr int ppm_type_local = ppm;
     const Real hx = dx[0];
     const Real hy = dx[1];
 
@@ -384,7 +452,7 @@ void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
     const auto rel_eps_local = rel_eps;
 
     // Get the index space of the valid region
-    const Box& obx = mfi.growntilebox(1);
+    const Box& obx = amrex::grow(tileBox, 1);
     const Box& mxbx = amrex::growLo(obx, 0, -1);
     const Box& mybx = amrex::growLo(obx, 1, -1);
 
@@ -393,119 +461,124 @@ void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
     const auto domhi = domainBox.hiVect3d();
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
-    AMREX_PARALLEL_FOR_3D(mxbx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(mxbx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         if (ppm_type_local == 0) {
             // make slx, srx with 1D extrapolation
-            slx(i,j,k) = s(i-1,j,k,comp) + (0.5 - dt2*umac(i,j,k)/hx)*Ip(i-1,j,k,0);
-            srx(i,j,k) = s(i,j,k,comp) - (0.5 + dt2*umac(i,j,k)/hx)*Ip(i,j,k,0);
+            slx(i,j,k,nc) = s(i-1,j,k,comp) + (0.5 - dt2*umac(i,j,k)/hx)*Ip(i-1,j,k,nc);
+            srx(i,j,k,nc) = s(i,j,k,comp) - (0.5 + dt2*umac(i,j,k)/hx)*Ip(i,j,k,nc);
         } else if (ppm_type_local == 1 || ppm_type_local == 2) {
             // make slx, srx with 1D extrapolation
-            slx(i,j,k) = Ip(i-1,j,k,0);
-            srx(i,j,k) = Im(i,j,k,0);
+            slx(i,j,k,nc) = Ip(i-1,j,k,nc);
+            srx(i,j,k,nc) = Im(i,j,k,nc);
         }
 
         // impose lo side bc's
         if (i == domlo[0]) {
             if (bclo == EXT_DIR) {
-                slx(i,j,k) = s(i-1,j,k,comp);
-                srx(i,j,k) = s(i-1,j,k,comp);
+                slx(i,j,k,nc) = s(i-1,j,k,comp);
+                srx(i,j,k,nc) = s(i-1,j,k,comp);
             } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
                 if (is_vel && comp == 0) {
-                    srx(i,j,k) = min(srx(i,j,k),0.0);
+                    srx(i,j,k,nc) = min(srx(i,j,k,nc),0.0);
                 }
-                slx(i,j,k) = srx(i,j,k);
+                slx(i,j,k,nc) = srx(i,j,k,nc);
             } else if (bclo == REFLECT_EVEN) {
-                slx(i,j,k) = srx(i,j,k);
+                slx(i,j,k,nc) = srx(i,j,k,nc);
             } else if (bclo == REFLECT_ODD) {
-                slx(i,j,k) = 0.0;
-                srx(i,j,k) = 0.0;
+                slx(i,j,k,nc) = 0.0;
+                srx(i,j,k,nc) = 0.0;
             }
 
         // impose hi side bc's
         } else if (i == domhi[0]+1) {
             if (bchi == EXT_DIR) {
-                slx(i,j,k) = s(i,j,k,comp);
-                srx(i,j,k) = s(i,j,k,comp);
+                slx(i,j,k,nc) = s(i,j,k,comp);
+                srx(i,j,k,nc) = s(i,j,k,comp);
             } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
                 if (is_vel && comp == 0) {
-                    slx(i,j,k) = max(slx(i,j,k),0.0);
+                    slx(i,j,k,nc) = max(slx(i,j,k,nc),0.0);
                 }
-                srx(i,j,k) = slx(i,j,k);
+                srx(i,j,k,nc) = slx(i,j,k,nc);
             } else if (bchi == REFLECT_EVEN) {
-                srx(i,j,k) = slx(i,j,k);
+                srx(i,j,k,nc) = slx(i,j,k,nc);
             } else if (bchi == REFLECT_ODD) {
-                slx(i,j,k) = 0.0;
-                srx(i,j,k) = 0.0;
+                slx(i,j,k,nc) = 0.0;
+                srx(i,j,k,nc) = 0.0;
             }
         }
 
         // make simhx by solving Riemann problem
-        simhx(i,j,k) = (umac(i,j,k) > 0.0) ? slx(i,j,k) : srx(i,j,k);
-        simhx(i,j,k) = (fabs(umac(i,j,k)) > rel_eps_local) ? 
-            simhx(i,j,k) : 0.5*(slx(i,j,k)+srx(i,j,k));
+        simhx(i,j,k,nc) = (umac(i,j,k) > 0.0) ? slx(i,j,k,nc) : srx(i,j,k,nc);
+        simhx(i,j,k,nc) = (fabs(umac(i,j,k)) > rel_eps_local) ? 
+            simhx(i,j,k,nc) : 0.5*(slx(i,j,k,nc)+srx(i,j,k,nc));
 
     });
 
     // loop over appropriate y-faces
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
-    AMREX_PARALLEL_FOR_3D(mybx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(mybx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
 
         if (ppm_type_local == 0) {
             // make sly, sry with 1D extrapolation
-            sly(i,j,k) = s(i,j-1,k,comp) + (0.5 - dt2*vmac(i,j,k)/hy)*Im(i,j-1,k,0);
-            sry(i,j,k) = s(i,j,k,comp) - (0.5 + dt2*vmac(i,j,k)/hy)*Im(i,j,k,0);
+            sly(i,j,k,nc) = s(i,j-1,k,comp) + (0.5 - dt2*vmac(i,j,k)/hy)*Im(i,j-1,k,nc);
+            sry(i,j,k,nc) = s(i,j,k,comp) - (0.5 + dt2*vmac(i,j,k)/hy)*Im(i,j,k,nc);
         } else if (ppm_type_local == 1 || ppm_type_local == 2) {
             // make sly, sry with 1D extrapolation
-            sly(i,j,k) = Ip(i,j-1,k,1);
-            sry(i,j,k) = Im(i,j,k,1);
+            sly(i,j,k,nc) = Ip(i,j-1,k,ncomp+nc);
+            sry(i,j,k,nc) = Im(i,j,k,ncomp+nc);
         }
 
         // impose lo side bc's
         if (j == domlo[1]) {
             if (bclo == EXT_DIR) {
-                sly(i,j,k) = s(i,j-1,k,comp);
-                sry(i,j,k) = s(i,j-1,k,comp);
+                sly(i,j,k,nc) = s(i,j-1,k,comp);
+                sry(i,j,k,nc) = s(i,j-1,k,comp);
             } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
                 if (is_vel && comp == 1) {
-                    sry(i,j,k) = min(sry(i,j,k),0.0);
+                    sry(i,j,k,nc) = min(sry(i,j,k,nc),0.0);
                 }
-                sly(i,j,k) = sry(i,j,k);
+                sly(i,j,k,nc) = sry(i,j,k,nc);
             } else if (bclo == REFLECT_EVEN) {
-                sly(i,j,k) = sry(i,j,k);
+                sly(i,j,k,nc) = sry(i,j,k,nc);
             } else if (bclo == REFLECT_ODD) {
-                sly(i,j,k) = 0.0;
-                sry(i,j,k) = 0.0;
+                sly(i,j,k,nc) = 0.0;
+                sry(i,j,k,nc) = 0.0;
             }
 
         // impose hi side bc's
         } else if (j == domhi[1]+1) {
             if (bchi == EXT_DIR) {
-                sly(i,j,k) = s(i,j,k,comp);
-                sry(i,j,k) = s(i,j,k,comp);
+                sly(i,j,k,nc) = s(i,j,k,comp);
+                sry(i,j,k,nc) = s(i,j,k,comp);
             } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
                 if (is_vel && comp == 1) {
-                    sly(i,j,k) = max(sly(i,j,k),0.0);
+                    sly(i,j,k,nc) = max(sly(i,j,k,nc),0.0);
                 }
-                sry(i,j,k) = sly(i,j,k);
+                sry(i,j,k,nc) = sly(i,j,k,nc);
             } else if (bchi == REFLECT_EVEN) {
-                sry(i,j,k) = sly(i,j,k);
+                sry(i,j,k,nc) = sly(i,j,k,nc);
             } else if (bchi == REFLECT_ODD) {
-                sly(i,j,k) = 0.0;
-                sry(i,j,k) = 0.0;
+                sly(i,j,k,nc) = 0.0;
+                sry(i,j,k,nc) = 0.0;
             }
         }
 
         // make simhy by solving Riemann problem
-        simhy(i,j,k) = (vmac(i,j,k) > 0.0) ? sly(i,j,k) : sry(i,j,k);
-        simhy(i,j,k) = (fabs(vmac(i,j,k)) > rel_eps_local) ? 
-            simhy(i,j,k) : 0.5*(sly(i,j,k)+sry(i,j,k));
+        simhy(i,j,k,nc) = (vmac(i,j,k) > 0.0) ? sly(i,j,k,nc) : sry(i,j,k,nc);
+        simhy(i,j,k,nc) = (fabs(vmac(i,j,k)) > rel_eps_local) ? 
+            simhy(i,j,k,nc) : 0.5*(sly(i,j,k,nc)+sry(i,j,k,nc));
     });
 }
 
-void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
+void Maestro::MakeEdgeScalEdges(const Box& tileBox,
+                            const Box& validBox,
                             Array4<Real> const slx,
                             Array4<Real> const srx,
                             Array4<Real> const sly,
@@ -523,7 +596,7 @@ void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
                             const Box& domainBox,
                             const Vector<BCRec>& bcs,
                             const amrex::GpuArray<Real,AMREX_SPACEDIM> dx,
-                            int comp, int bccomp, 
+                            int start_comp, int bccomp, int ncomp, 
                             bool is_vel, bool is_conservative) 
 {
     // timer for profiling
@@ -546,41 +619,43 @@ void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
     const auto domlo = domainBox.loVect3d();
     const auto domhi = domainBox.hiVect3d();
 
-    const Box& xbx = mfi.nodaltilebox(0);
-    const Box& ybx = mfi.nodaltilebox(1);
+    const Box& xbx = EdgeScalFaceBox(tileBox, validBox, 0);
+    const Box& ybx = EdgeScalFaceBox(tileBox, validBox, 1);
 
     // x-direction
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
-    AMREX_PARALLEL_FOR_3D(xbx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(xbx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real sedgelx = 0.0;
         Real sedgerx = 0.0;
 
         Real fl = (ppm_trace_forces_local == 0) ? 
-            force(i-1,j,k,comp) : Ipf(i-1,j,k,0);
+            force(i-1,j,k,comp) : Ipf(i-1,j,k,nc);
         Real fr = (ppm_trace_forces_local == 0) ? 
-            force(i,j,k,comp) : Imf(i,j,k,0);
+            force(i,j,k,comp) : Imf(i,j,k,nc);
 
         if (is_conservative) {
-            sedgelx = slx(i,j,k)
-                - (dt2/hy)*(simhy(i-1,j+1,k)*vmac(i-1,j+1,k) 
-                - simhy(i-1,j,k)*vmac(i-1,j,k))
+            sedgelx = slx(i,j,k,nc)
+                - (dt2/hy)*(simhy(i-1,j+1,k,nc)*vmac(i-1,j+1,k) 
+                - simhy(i-1,j,k,nc)*vmac(i-1,j,k))
                 - (dt2/hx)*s(i-1,j,k,comp)*(umac(i  ,j,k)-umac(i-1,j,k))
                 + dt2*fl;
-            sedgerx = srx(i,j,k)
-                - (dt2/hy)*(simhy(i  ,j+1,k)*vmac(i  ,j+1,k) 
-                - simhy(i  ,j,k)*vmac(i  ,j,k))
+            sedgerx = srx(i,j,k,nc)
+                - (dt2/hy)*(simhy(i  ,j+1,k,nc)*vmac(i  ,j+1,k) 
+                - simhy(i  ,j,k,nc)*vmac(i  ,j,k))
                 - (dt2/hx)*s(i  ,j,k,comp)*(umac(i+1,j,k)-umac(i  ,j,k))
                 + dt2*fr;
         } else {
-            sedgelx = slx(i,j,k)
+            sedgelx = slx(i,j,k,nc)
                 - (dt4/hy)*(vmac(i-1,j+1,k)+vmac(i-1,j,k))*
-                (simhy(i-1,j+1,k)-simhy(i-1,j,k))
+                (simhy(i-1,j+1,k,nc)-simhy(i-1,j,k,nc))
                 + dt2*fl;
-            sedgerx = srx(i,j,k)
+            sedgerx = srx(i,j,k,nc)
                 - (dt4/hy)*(vmac(i  ,j+1,k)+vmac(i  ,j,k))*
-                (simhy(i  ,j+1,k)-simhy(i  ,j,k))
+                (simhy(i  ,j+1,k,nc)-simhy(i  ,j,k,nc))
                 + dt2*fr;
         }
 
@@ -627,32 +702,34 @@ void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
     // y-direction
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
-    AMREX_PARALLEL_FOR_3D(ybx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(ybx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real sedgely = 0.0;
         Real sedgery = 0.0;
 
         Real fl = (ppm_trace_forces_local == 0) ? 
-            force(i,j-1,k,comp) : Ipf(i,j-1,k,1);
+            force(i,j-1,k,comp) : Ipf(i,j-1,k,ncomp+nc);
         Real fr = (ppm_trace_forces_local == 0) ? 
-            force(i,j,k,comp) : Imf(i,j,k,1);
+            force(i,j,k,comp) : Imf(i,j,k,ncomp+nc);
 
         // make sedgely, sedgery
         if (is_conservative) {
-            sedgely = sly(i,j,k)
-                   - (dt2/hx)*(simhx(i+1,j-1,k)*umac(i+1,j-1,k) - simhx(i,j-1,k)*umac(i,j-1,k))
+            sedgely = sly(i,j,k,nc)
+                   - (dt2/hx)*(simhx(i+1,j-1,k,nc)*umac(i+1,j-1,k) - simhx(i,j-1,k,nc)*umac(i,j-1,k))
                    - (dt2/hy)*s(i,j-1,k,comp)*(vmac(i,j,k)-vmac(i,j-1,k))
                    + dt2*fl;
-            sedgery = sry(i,j,k)
-                - (dt2/hx)*(simhx(i+1,j,k)*umac(i+1,j,k) - simhx(i,j,k)*umac(i,j,k))
+            sedgery = sry(i,j,k,nc)
+                - (dt2/hx)*(simhx(i+1,j,k,nc)*umac(i+1,j,k) - simhx(i,j,k,nc)*umac(i,j,k))
                 - (dt2/hy)*s(i,j,k,comp)*(vmac(i,j+1,k)-vmac(i,j,k))
                 + dt2*fr;
         } else {
-            sedgely = sly(i,j,k)
-                - (dt4/hx)*(umac(i+1,j-1,k)+umac(i,j-1,k))*(simhx(i+1,j-1,k)-simhx(i,j-1,k))
+            sedgely = sly(i,j,k,nc)
+                - (dt4/hx)*(umac(i+1,j-1,k)+umac(i,j-1,k))*(simhx(i+1,j-1,k,nc)-simhx(i,j-1,k,nc))
                 + dt2*fl;
-            sedgery = sry(i,j,k)
-                - (dt4/hx)*(umac(i+1,j,k)+umac(i,j,k))*(simhx(i+1,j,k)-simhx(i,j,k))
+            sedgery = sry(i,j,k,nc)
+                - (dt4/hx)*(umac(i+1,j,k)+umac(i,j,k))*(simhx(i+1,j,k,nc)-simhx(i,j,k,nc))
                 + dt2*fr;
         }
 
@@ -718,7 +795,8 @@ void Maestro::MakeDivU(const Box& bx,
     });
 }
 
-void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
+template <int ppm>
+void Maestro::MakeEdgeScalPredictor(const Box& tileBox,
                                     Array4<Real> const slx,
                                     Array4<Real> const srx,
                                     Array4<Real> const sly,
@@ -738,7 +816,7 @@ void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
                                     const Box& domainBox,
                                     const Vector<BCRec>& bcs,
                                     const amrex::GpuArray<Real,AMREX_SPACEDIM> dx,
-                                    int comp, int bccomp, bool is_vel)
+                                    int start_comp, int bccomp, int ncomp, bool is_vel)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeEdgeScalPredictor()",MakeEdgeScalPredictor);
@@ -747,14 +825,15 @@ void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
     // Create s_{\i-\half\e_x}^x, etc.
     ///////////////////////////////////////
 
-    Real ppm_type_local = ppm_type;
+    // ppm_type is a template parameter, so the tests of it in the kernels
+    // below are resolved at compile time
+    constexpr int ppm_type_local = ppm;
     const Real dt_loc = dt;
     Real hx = dx[0];
     Real hy = dx[1];
     Real hz = dx[2];
 
     // Get the index space of the valid region
-    const Box& tileBox = mfi.tilebox();
     const Box& obx = amrex::grow(tileBox, 1);
     const Box& mxbx = amrex::growLo(obx, 0, -1);
     const Box& mybx = amrex::growLo(obx, 1, -1);
@@ -765,175 +844,181 @@ void Maestro::MakeEdgeScalPredictor(const MFIter& mfi,
     const auto domhi = domainBox.hiVect3d();
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
-    AMREX_PARALLEL_FOR_3D(mxbx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(mxbx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         if (ppm_type_local == 0) {
-            slx(i,j,k) = scal(i-1,j,k,comp) + 
-                0.5 * (1.0 - dt_loc * umac(i,j,k) / hx) * Ip(i-1,j,k,0);
-            srx(i,j,k) = scal(i,j,k,comp) - 
-                0.5 * (1.0 + dt_loc * umac(i,j,k) / hx) * Ip(i,j,k,0);
+            slx(i,j,k,nc) = scal(i-1,j,k,comp) + 
+                0.5 * (1.0 - dt_loc * umac(i,j,k) / hx) * Ip(i-1,j,k,nc);
+            srx(i,j,k,nc) = scal(i,j,k,comp) - 
+                0.5 * (1.0 + dt_loc * umac(i,j,k) / hx) * Ip(i,j,k,nc);
         } else if (ppm_type_local == 1 || ppm_type_local == 2) {
-            slx(i,j,k) = Ip(i-1,j,k,0);
-            srx(i,j,k) = Im(i,j,k,0);
+            slx(i,j,k,nc) = Ip(i-1,j,k,nc);
+            srx(i,j,k,nc) = Im(i,j,k,nc);
         }
 
         // impose lo side bc's
         if (i == domlo[0]) {
             if (bclo == EXT_DIR) {
-                slx(i,j,k) = scal(i-1,j,k,comp);
-                srx(i,j,k) = scal(i-1,j,k,comp);
+                slx(i,j,k,nc) = scal(i-1,j,k,comp);
+                srx(i,j,k,nc) = scal(i-1,j,k,comp);
             } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
                 if (is_vel && comp == 0) {
-                    srx(i,j,k) = min(srx(i,j,k), 0.0);
+                    srx(i,j,k,nc) = min(srx(i,j,k,nc), 0.0);
                 }
-                slx(i,j,k) = srx(i,j,k);
+                slx(i,j,k,nc) = srx(i,j,k,nc);
             } else if (bclo == REFLECT_EVEN) {
-                slx(i,j,k) = srx(i,j,k);
+                slx(i,j,k,nc) = srx(i,j,k,nc);
             } else if (bclo == REFLECT_ODD) {
-                slx(i,j,k) = 0.0;
-                srx(i,j,k) = 0.0;
+                slx(i,j,k,nc) = 0.0;
+                srx(i,j,k,nc) = 0.0;
             }
 
         // impose hi side bc's
         } else if (i == domhi[0]+1) {
             if (bchi == EXT_DIR) {
-                slx(i,j,k) = scal(i,j,k,comp);
-                srx(i,j,k) = scal(i,j,k,comp);
+                slx(i,j,k,nc) = scal(i,j,k,comp);
+                srx(i,j,k,nc) = scal(i,j,k,comp);
             } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
                 if (is_vel && comp == 0) {
-                    slx(i,j,k) = max(slx(i,j,k), 0.0);
+                    slx(i,j,k,nc) = max(slx(i,j,k,nc), 0.0);
                 }
-                srx(i,j,k) = slx(i,j,k);
+                srx(i,j,k,nc) = slx(i,j,k,nc);
             } else if (bchi == REFLECT_EVEN) {
-                srx(i,j,k) = slx(i,j,k);
+                srx(i,j,k,nc) = slx(i,j,k,nc);
             } else if (bchi == REFLECT_ODD) {
-                slx(i,j,k) = 0.0;
-                srx(i,j,k) = 0.0;
+                slx(i,j,k,nc) = 0.0;
+                srx(i,j,k,nc) = 0.0;
             }
         }
 
         // make simhx by solving Riemann problem
-        simhx(i,j,k) = (umac(i,j,k) > 0.0) ? 
-            slx(i,j,k) : srx(i,j,k);
-        simhx(i,j,k) = (fabs(umac(i,j,k)) > 0.0) ? 
-            simhx(i,j,k) : 0.5 * (slx(i,j,k) + srx(i,j,k));
+        simhx(i,j,k,nc) = (umac(i,j,k) > 0.0) ? 
+            slx(i,j,k,nc) : srx(i,j,k,nc);
+        simhx(i,j,k,nc) = (fabs(umac(i,j,k)) > 0.0) ? 
+            simhx(i,j,k,nc) : 0.5 * (slx(i,j,k,nc) + srx(i,j,k,nc));
     });
 
     // loop over appropriate y-faces
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
-    AMREX_PARALLEL_FOR_3D(mybx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(mybx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         if (ppm_type_local == 0) {
-            sly(i,j,k) = scal(i,j-1,k,comp) + 
-                0.5 * (1.0 - dt_loc * vmac(i,j,k) / hy) * Im(i,j-1,k,0);
-            sry(i,j,k) = scal(i,j,k,comp) - 
-                0.5 * (1.0 + dt_loc * vmac(i,j,k) / hy) * Im(i,j,k,0);
+            sly(i,j,k,nc) = scal(i,j-1,k,comp) + 
+                0.5 * (1.0 - dt_loc * vmac(i,j,k) / hy) * Im(i,j-1,k,nc);
+            sry(i,j,k,nc) = scal(i,j,k,comp) - 
+                0.5 * (1.0 + dt_loc * vmac(i,j,k) / hy) * Im(i,j,k,nc);
         } else if (ppm_type_local == 1 || ppm_type_local == 2) {
-            sly(i,j,k) = Ip(i,j-1,k,1);
-            sry(i,j,k) = Im(i,j,k,1);
+            sly(i,j,k,nc) = Ip(i,j-1,k,ncomp+nc);
+            sry(i,j,k,nc) = Im(i,j,k,ncomp+nc);
         }
 
         // impose lo side bc's
         if (j == domlo[1]) {
             if (bclo == EXT_DIR) {
-                sly(i,j,k) = scal(i,j-1,k,comp);
-                sry(i,j,k) = scal(i,j-1,k,comp);
+                sly(i,j,k,nc) = scal(i,j-1,k,comp);
+                sry(i,j,k,nc) = scal(i,j-1,k,comp);
             } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
                 if (is_vel && comp == 1) {
-                    sry(i,j,k) = min(sry(i,j,k), 0.0);
+                    sry(i,j,k,nc) = min(sry(i,j,k,nc), 0.0);
                 }
-                sly(i,j,k) = sry(i,j,k);
+                sly(i,j,k,nc) = sry(i,j,k,nc);
             } else if (bclo == REFLECT_EVEN) {
-                sly(i,j,k) = sry(i,j,k);
+                sly(i,j,k,nc) = sry(i,j,k,nc);
             } else if (bclo == REFLECT_ODD) {
-                sly(i,j,k) = 0.0;
-                sry(i,j,k) = 0.0;
+                sly(i,j,k,nc) = 0.0;
+                sry(i,j,k,nc) = 0.0;
             }
         // impose hi side bc's
         } else if (j == domhi[1]+1) {
             if (bchi == EXT_DIR) {
-                sly(i,j,k) = scal(i,j,k,comp);
-                sry(i,j,k) = scal(i,j,k,comp);
+                sly(i,j,k,nc) = scal(i,j,k,comp);
+                sry(i,j,k,nc) = scal(i,j,k,comp);
             } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
                 if (is_vel && comp == 1) {
-                    sly(i,j,k) = max(sly(i,j,k), 0.0);
+                    sly(i,j,k,nc) = max(sly(i,j,k,nc), 0.0);
                 }
-                sry(i,j,k) = sly(i,j,k);
+                sry(i,j,k,nc) = sly(i,j,k,nc);
             } else if (bchi == REFLECT_EVEN) {
-                sry(i,j,k) = sly(i,j,k);
+                sry(i,j,k,nc) = sly(i,j,k,nc);
             } else if (bchi == REFLECT_ODD) {
-                sly(i,j,k) = 0.0;
-                sry(i,j,k) = 0.0;
+                sly(i,j,k,nc) = 0.0;
+                sry(i,j,k,nc) = 0.0;
             }
         }
 
         // make simhy by solving Riemann problem
-        simhy(i,j,k) = (vmac(i,j,k) > 0.0) ? 
-            sly(i,j,k) : sry(i,j,k);
-        simhy(i,j,k) = (fabs(vmac(i,j,k)) > 0.0) ? 
-            simhy(i,j,k) : 0.5 * (sly(i,j,k) + sry(i,j,k));
+        simhy(i,j,k,nc) = (vmac(i,j,k) > 0.0) ? 
+            sly(i,j,k,nc) : sry(i,j,k,nc);
+        simhy(i,j,k,nc) = (fabs(vmac(i,j,k)) > 0.0) ? 
+            simhy(i,j,k,nc) : 0.5 * (sly(i,j,k,nc) + sry(i,j,k,nc));
 
     });
 
     // loop over appropriate z-faces
     bclo = bcs[bccomp].lo()[2];
     bchi = bcs[bccomp].hi()[2];
-    AMREX_PARALLEL_FOR_3D(mzbx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(mzbx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         if (ppm_type_local == 0) {
-            slz(i,j,k) = scal(i,j,k-1,comp) + 
-                0.5 * (1.0 - dt_loc * wmac(i,j,k) / hz) * slopez(i,j,k-1);
-            srz(i,j,k) = scal(i,j,k,comp) - 
-                0.5 * (1.0 + dt_loc * wmac(i,j,k) / hz) * slopez(i,j,k);
+            slz(i,j,k,nc) = scal(i,j,k-1,comp) + 
+                0.5 * (1.0 - dt_loc * wmac(i,j,k) / hz) * slopez(i,j,k-1,nc);
+            srz(i,j,k,nc) = scal(i,j,k,comp) - 
+                0.5 * (1.0 + dt_loc * wmac(i,j,k) / hz) * slopez(i,j,k,nc);
         } else if (ppm_type_local == 1 || ppm_type_local == 2) {
-            slz(i,j,k) = Ip(i,j,k-1,2);
-            srz(i,j,k) = Im(i,j,k,2);
+            slz(i,j,k,nc) = Ip(i,j,k-1,2*ncomp+nc);
+            srz(i,j,k,nc) = Im(i,j,k,2*ncomp+nc);
         }
 
         // impose lo side bc's
         if (k == domlo[2]) {
             if (bclo == EXT_DIR) {
-                slz(i,j,k) = scal(i,j,k-1,comp);
-                srz(i,j,k) = scal(i,j,k-1,comp);
+                slz(i,j,k,nc) = scal(i,j,k-1,comp);
+                srz(i,j,k,nc) = scal(i,j,k-1,comp);
             } else if (bclo == FOEXTRAP || bclo == HOEXTRAP) {
                 if (is_vel && comp == 2) {
-                    srz(i,j,k) = min(srz(i,j,k), 0.0);
+                    srz(i,j,k,nc) = min(srz(i,j,k,nc), 0.0);
                 }
-                slz(i,j,k) = srz(i,j,k);
+                slz(i,j,k,nc) = srz(i,j,k,nc);
             } else if (bclo == REFLECT_EVEN) {
-                slz(i,j,k) = srz(i,j,k);
+                slz(i,j,k,nc) = srz(i,j,k,nc);
             } else if (bclo == REFLECT_ODD) {
-                slz(i,j,k) = 0.0;
-                srz(i,j,k) = 0.0;
+                slz(i,j,k,nc) = 0.0;
+                srz(i,j,k,nc) = 0.0;
             }
         // impose hi side bc's
         } else if (k == domhi[2]+1) {
             if (bchi == EXT_DIR) {
-                slz(i,j,k) = scal(i,j,k,comp);
-                srz(i,j,k) = scal(i,j,k,comp);
+                slz(i,j,k,nc) = scal(i,j,k,comp);
+                srz(i,j,k,nc) = scal(i,j,k,comp);
             } else if (bchi == FOEXTRAP || bchi == HOEXTRAP) {
                 if (is_vel && comp == 2) {
-                    slz(i,j,k) = max(slz(i,j,k), 0.0);
+                    slz(i,j,k,nc) = max(slz(i,j,k,nc), 0.0);
                 }
-                srz(i,j,k) = slz(i,j,k);
+                srz(i,j,k,nc) = slz(i,j,k,nc);
             } else if (bchi == REFLECT_EVEN) {
-                srz(i,j,k) = slz(i,j,k);
+                srz(i,j,k,nc) = slz(i,j,k,nc);
             } else if (bchi == REFLECT_ODD) {
-                slz(i,j,k) = 0.0;
-                srz(i,j,k) = 0.0;
+                slz(i,j,k,nc) = 0.0;
+                srz(i,j,k,nc) = 0.0;
             }
         }
 
-        simhz(i,j,k) = (wmac(i,j,k) > 0.0) ? 
-            slz(i,j,k) : srz(i,j,k);
-        simhz(i,j,k) = (fabs(wmac(i,j,k)) > 0.0) ?
-            simhz(i,j,k) : 0.5 * (slz(i,j,k) + srz(i,j,k));
+        simhz(i,j,k,nc) = (wmac(i,j,k) > 0.0) ? 
+            slz(i,j,k,nc) : srz(i,j,k,nc);
+        simhz(i,j,k,nc) = (fabs(wmac(i,j,k)) > 0.0) ?
+            simhz(i,j,k,nc) : 0.5 * (slz(i,j,k,nc) + srz(i,j,k,nc));
     });
 
 }
 
-void Maestro::MakeEdgeScalTransverse(const MFIter& mfi,
+void Maestro::MakeEdgeScalTransverse(const Box& tileBox,
                                     Array4<Real> const slx,
                                     Array4<Real> const srx,
                                     Array4<Real> const sly,
@@ -957,7 +1042,7 @@ void Maestro::MakeEdgeScalTransverse(const MFIter& mfi,
                                     const Box& domainBox,
                                     const Vector<BCRec>& bcs,
                                     const amrex::GpuArray<Real,AMREX_SPACEDIM> dx,
-                                    int comp, int bccomp, 
+                                    int start_comp, int bccomp, int ncomp, 
                                     bool is_vel, bool is_conservative)
 {
     // timer for profiling
@@ -980,39 +1065,41 @@ void Maestro::MakeEdgeScalTransverse(const MFIter& mfi,
     const auto domhi = domainBox.hiVect3d();
 
     // simhxy
-    Box imhbox = amrex::grow(mfi.tilebox(), 2, 1);
+    Box imhbox = amrex::grow(tileBox, 2, 1);
     imhbox = amrex::growHi(imhbox, 0, 1);
     // Box imhbox = mfi.grownnodaltilebox(0, amrex::IntVect(0,0,1)); 
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
-    AMREX_PARALLEL_FOR_3D(imhbox, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(imhbox, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real slxy = 0.0;
         Real srxy = 0.0;
         
         // loop over appropriate xy faces
         if (is_conservative) {
             // make slxy, srxy by updating 1D extrapolation
-            slxy = slx(i,j,k) 
-                - (dt3/hy) * (simhy(i-1,j+1,k)*vmac(i-1,j+1,k) 
-                - simhy(i-1,j,k)*vmac(i-1,j,k)) 
+            slxy = slx(i,j,k,nc) 
+                - (dt3/hy) * (simhy(i-1,j+1,k,nc)*vmac(i-1,j+1,k) 
+                - simhy(i-1,j,k,nc)*vmac(i-1,j,k)) 
                 - dt3*scal(i-1,j,k,comp)*divu(i-1,j,k) 
                 + (dt3/hy)*scal(i-1,j,k,comp)*
                 (vmac(i-1,j+1,k)-vmac(i-1,j,k));
-            srxy = srx(i,j,k) 
-                - (dt3/hy)*(simhy(i,j+1,k)*vmac(i,j+1,k)
-                - simhy(i,j,k)*vmac(i,j,k)) 
+            srxy = srx(i,j,k,nc) 
+                - (dt3/hy)*(simhy(i,j+1,k,nc)*vmac(i,j+1,k)
+                - simhy(i,j,k,nc)*vmac(i,j,k)) 
                 - dt3*scal(i,j,k,comp)*divu(i,j,k) 
                 + (dt3/hy)*scal(i,j,k,comp)*
                 (vmac(i,j+1,k)-vmac(i,j,k));
         } else {
             // make slxy, srxy by updating 1D extrapolation
-            slxy = slx(i,j,k) 
+            slxy = slx(i,j,k,nc) 
                 - (dt6/hy)*(vmac(i-1,j+1,k)+vmac(i-1,j,k)) 
-                *(simhy(i-1,j+1,k)-simhy(i-1,j,k));
-            srxy = srx(i,j,k) 
+                *(simhy(i-1,j+1,k,nc)-simhy(i-1,j,k,nc));
+            srxy = srx(i,j,k,nc) 
                 - (dt6/hy)*(vmac(i,j+1,k)+vmac(i,j,k))
-                *(simhy(i,j+1,k)-simhy(i,j,k));
+                *(simhy(i,j+1,k,nc)-simhy(i,j,k,nc));
         }
 
         // impose lo side bc's
@@ -1051,45 +1138,47 @@ void Maestro::MakeEdgeScalTransverse(const MFIter& mfi,
         }
 
         // make simhxy by solving Riemann problem
-        simhxy(i,j,k) = (umac(i,j,k) > 0.0) ?
+        simhxy(i,j,k,nc) = (umac(i,j,k) > 0.0) ?
             slxy : srxy;
-        simhxy(i,j,k) = (fabs(umac(i,j,k)) > rel_eps_local) ?
-            simhxy(i,j,k) : 0.5 * (slxy + srxy);
+        simhxy(i,j,k,nc) = (fabs(umac(i,j,k)) > rel_eps_local) ?
+            simhxy(i,j,k,nc) : 0.5 * (slxy + srxy);
 
     });
 
     // simhxz
-    imhbox = amrex::grow(mfi.tilebox(), 1, 1);
+    imhbox = amrex::grow(tileBox, 1, 1);
     imhbox = amrex::growHi(imhbox, 0, 1);
     // imhbox = mfi.grownnodaltilebox(0, amrex::IntVect(0,1,0));
 
-    AMREX_PARALLEL_FOR_3D(imhbox, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(imhbox, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real slxz = 0.0;
         Real srxz = 0.0;
         // loop over appropriate xz faces
         if (is_conservative) {
             // make slxz, srxz by updating 1D extrapolation
-            slxz = slx(i,j,k) 
-                - (dt3/hz) * (simhz(i-1,j,k+1)*wmac(i-1,j,k+1) 
-                - simhz(i-1,j,k)*wmac(i-1,j,k)) 
+            slxz = slx(i,j,k,nc) 
+                - (dt3/hz) * (simhz(i-1,j,k+1,nc)*wmac(i-1,j,k+1) 
+                - simhz(i-1,j,k,nc)*wmac(i-1,j,k)) 
                 - dt3*scal(i-1,j,k,comp)*divu(i-1,j,k) 
                 + (dt3/hz)*scal(i-1,j,k,comp)*
                 (wmac(i-1,j,k+1)-wmac(i-1,j,k));
-            srxz = srx(i,j,k) 
-                - (dt3/hz)*(simhz(i,j,k+1)*wmac(i,j,k+1)
-                - simhz(i,j,k)*wmac(i,j,k)) 
+            srxz = srx(i,j,k,nc) 
+                - (dt3/hz)*(simhz(i,j,k+1,nc)*wmac(i,j,k+1)
+                - simhz(i,j,k,nc)*wmac(i,j,k)) 
                 - dt3*scal(i,j,k,comp)*divu(i,j,k) 
                 + (dt3/hz)*scal(i,j,k,comp)*
                 (wmac(i,j,k+1)-wmac(i,j,k));
         } else {
             // make slxz, srxz by updating 1D extrapolation
-            slxz = slx(i,j,k) 
+            slxz = slx(i,j,k,nc) 
                 - (dt6/hz)*(wmac(i-1,j,k+1)+wmac(i-1,j,k)) 
-                *(simhz(i-1,j,k+1)-simhz(i-1,j,k));
-            srxz = srx(i,j,k) 
+                *(simhz(i-1,j,k+1,nc)-simhz(i-1,j,k,nc));
+            srxz = srx(i,j,k,nc) 
                 - (dt6/hz)*(wmac(i,j,k+1)+wmac(i,j,k)) 
-                *(simhz(i,j,k+1)-simhz(i,j,k));
+                *(simhz(i,j,k+1,nc)-simhz(i,j,k,nc));
         }
 
         // impose lo side bc's
@@ -1128,48 +1217,50 @@ void Maestro::MakeEdgeScalTransverse(const MFIter& mfi,
         }
 
         // make simhxy by solving Riemann problem
-        simhxz(i,j,k) = (umac(i,j,k) > 0.0) ?
+        simhxz(i,j,k,nc) = (umac(i,j,k) > 0.0) ?
             slxz : srxz;
-        simhxz(i,j,k) = (fabs(umac(i,j,k)) > rel_eps_local) ?
-            simhxz(i,j,k) : 0.5 * (slxz + srxz);
+        simhxz(i,j,k,nc) = (fabs(umac(i,j,k)) > rel_eps_local) ?
+            simhxz(i,j,k,nc) : 0.5 * (slxz + srxz);
 
     });
 
     // simhyx
     // imhbox = mfi.grownnodaltilebox(1, amrex::IntVect(0,0,1));
-    imhbox = amrex::grow(mfi.tilebox(), 2, 1);
+    imhbox = amrex::grow(tileBox, 2, 1);
     imhbox = amrex::growHi(imhbox, 1, 1);
 
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
 
-    AMREX_PARALLEL_FOR_3D(imhbox, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(imhbox, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real slyx = 0.0;
         Real sryx = 0.0;
         // loop over appropriate yx faces
         if (is_conservative) {
             // make slyx, sryx by updating 1D extrapolation
-            slyx = sly(i,j,k) 
-                - (dt3/hx) * (simhx(i+1,j-1,k)*umac(i+1,j-1,k) 
-                - simhx(i,j-1,k)*umac(i,j-1,k)) 
+            slyx = sly(i,j,k,nc) 
+                - (dt3/hx) * (simhx(i+1,j-1,k,nc)*umac(i+1,j-1,k) 
+                - simhx(i,j-1,k,nc)*umac(i,j-1,k)) 
                 - dt3*scal(i,j-1,k,comp)*divu(i,j-1,k) 
                 + (dt3/hx)*scal(i,j-1,k,comp)*
                 (umac(i+1,j-1,k)-umac(i,j-1,k));
-            sryx = sry(i,j,k) 
-                - (dt3/hx)*(simhx(i+1,j,k)*umac(i+1,j,k)
-                - simhx(i,j,k)*umac(i,j,k)) 
+            sryx = sry(i,j,k,nc) 
+                - (dt3/hx)*(simhx(i+1,j,k,nc)*umac(i+1,j,k)
+                - simhx(i,j,k,nc)*umac(i,j,k)) 
                 - dt3*scal(i,j,k,comp)*divu(i,j,k) 
                 + (dt3/hx)*scal(i,j,k,comp)*
                 (umac(i+1,j,k)-umac(i,j,k));
         } else {
             // make slyx, sryx by updating 1D extrapolation
-            slyx = sly(i,j,k) 
+            slyx = sly(i,j,k,nc) 
                 - (dt6/hx)*(umac(i+1,j-1,k)+umac(i,j-1,k)) 
-                *(simhx(i+1,j-1,k)-simhx(i,j-1,k));
-            sryx = sry(i,j,k) 
+                *(simhx(i+1,j-1,k,nc)-simhx(i,j-1,k,nc));
+            sryx = sry(i,j,k,nc) 
                 - (dt6/hx)*(umac(i+1,j,k)+umac(i,j,k)) 
-                *(simhx(i+1,j,k)-simhx(i,j,k));
+                *(simhx(i+1,j,k,nc)-simhx(i,j,k,nc));
         }
 
         // impose lo side bc's
@@ -1208,44 +1299,46 @@ void Maestro::MakeEdgeScalTransverse(const MFIter& mfi,
         }
 
         // make simhxy by solving Riemann problem
-        simhyx(i,j,k) = (vmac(i,j,k) > 0.0) ?
+        simhyx(i,j,k,nc) = (vmac(i,j,k) > 0.0) ?
             slyx : sryx;
-        simhyx(i,j,k) = (fabs(vmac(i,j,k)) > rel_eps_local) ?
-            simhyx(i,j,k) : 0.5 * (slyx + sryx);
+        simhyx(i,j,k,nc) = (fabs(vmac(i,j,k)) > rel_eps_local) ?
+            simhyx(i,j,k,nc) : 0.5 * (slyx + sryx);
     });
 
     // simhyz
     // imhbox = mfi.grownnodaltilebox(1, amrex::IntVect(1,0,0)); 
-    imhbox = amrex::grow(mfi.tilebox(), 0, 1);
+    imhbox = amrex::grow(tileBox, 0, 1);
     imhbox = amrex::growHi(imhbox, 1, 1);
 
-    AMREX_PARALLEL_FOR_3D(imhbox, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(imhbox, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real slyz = 0.0;
         Real sryz = 0.0;
         // loop over appropriate yz faces
         if (is_conservative) {
             // make slyz, sryz by updating 1D extrapolation
-            slyz = sly(i,j,k) 
-                - (dt3/hz) * (simhz(i,j-1,k+1)*wmac(i,j-1,k+1) 
-                - simhz(i,j-1,k)*wmac(i,j-1,k)) 
+            slyz = sly(i,j,k,nc) 
+                - (dt3/hz) * (simhz(i,j-1,k+1,nc)*wmac(i,j-1,k+1) 
+                - simhz(i,j-1,k,nc)*wmac(i,j-1,k)) 
                 - dt3*scal(i,j-1,k,comp)*divu(i,j-1,k) 
                 + (dt3/hz)*scal(i,j-1,k,comp)*
                 (wmac(i,j-1,k+1)-wmac(i,j-1,k));
-            sryz = sry(i,j,k) 
-                - (dt3/hz)*(simhz(i,j,k+1)*wmac(i,j,k+1)
-                - simhz(i,j,k)*wmac(i,j,k)) 
+            sryz = sry(i,j,k,nc) 
+                - (dt3/hz)*(simhz(i,j,k+1,nc)*wmac(i,j,k+1)
+                - simhz(i,j,k,nc)*wmac(i,j,k)) 
                 - dt3*scal(i,j,k,comp)*divu(i,j,k) 
                 + (dt3/hz)*scal(i,j,k,comp)*
                 (wmac(i,j,k+1)-wmac(i,j,k));
         } else {
             // make slyz, sryz by updating 1D extrapolation
-            slyz = sly(i,j,k) 
+            slyz = sly(i,j,k,nc) 
                 - (dt6/hz)*(wmac(i,j-1,k+1)+wmac(i,j-1,k)) 
-                *(simhz(i,j-1,k+1)-simhz(i,j-1,k));
-            sryz = sry(i,j,k) 
+                *(simhz(i,j-1,k+1,nc)-simhz(i,j-1,k,nc));
+            sryz = sry(i,j,k,nc) 
                 - (dt6/hz)*(wmac(i,j,k+1)+wmac(i,j,k)) 
-                *(simhz(i,j,k+1)-simhz(i,j,k));
+                *(simhz(i,j,k+1,nc)-simhz(i,j,k,nc));
         }
 
         // impose lo side bc's
@@ -1284,47 +1377,49 @@ void Maestro::MakeEdgeScalTransverse(const MFIter& mfi,
         }
 
         // make simhyz by solving Riemann problem
-        simhyz(i,j,k) = (vmac(i,j,k) > 0.0) ?
+        simhyz(i,j,k,nc) = (vmac(i,j,k) > 0.0) ?
             slyz : sryz;
-        simhyz(i,j,k) = (fabs(vmac(i,j,k)) > rel_eps_local) ?
-            simhyz(i,j,k) : 0.5 * (slyz + sryz);
+        simhyz(i,j,k,nc) = (fabs(vmac(i,j,k)) > rel_eps_local) ?
+            simhyz(i,j,k,nc) : 0.5 * (slyz + sryz);
     });
 
     // simhzx
     // imhbox = mfi.grownnodaltilebox(2, amrex::IntVect(0,1,0));
-    imhbox = amrex::grow(mfi.tilebox(), 1, 1);
+    imhbox = amrex::grow(tileBox, 1, 1);
     imhbox = amrex::growHi(imhbox, 2, 1);
 
     bclo = bcs[bccomp].lo()[2];
     bchi = bcs[bccomp].hi()[2];
 
-    AMREX_PARALLEL_FOR_3D(imhbox, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(imhbox, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real slzx = 0.0;
         Real srzx = 0.0;
         // loop over appropriate zx faces
         if (is_conservative) {
             // make slzx, srzx by updating 1D extrapolation
-            slzx = slz(i,j,k) 
-                - (dt3/hx) * (simhx(i+1,j,k-1)*umac(i+1,j,k-1) 
-                - simhx(i,j,k-1)*umac(i,j,k-1)) 
+            slzx = slz(i,j,k,nc) 
+                - (dt3/hx) * (simhx(i+1,j,k-1,nc)*umac(i+1,j,k-1) 
+                - simhx(i,j,k-1,nc)*umac(i,j,k-1)) 
                 - dt3*scal(i,j,k-1,comp)*divu(i,j,k-1) 
                 + (dt3/hx)*scal(i,j,k-1,comp)*
                 (umac(i+1,j,k-1)-umac(i,j,k-1));
-            srzx = srz(i,j,k) 
-                - (dt3/hx)*(simhx(i+1,j,k)*umac(i+1,j,k)
-                - simhx(i,j,k)*umac(i,j,k)) 
+            srzx = srz(i,j,k,nc) 
+                - (dt3/hx)*(simhx(i+1,j,k,nc)*umac(i+1,j,k)
+                - simhx(i,j,k,nc)*umac(i,j,k)) 
                 - dt3*scal(i,j,k,comp)*divu(i,j,k) 
                 + (dt3/hx)*scal(i,j,k,comp)*
                 (umac(i+1,j,k)-umac(i,j,k));
         } else {
             // make slzx, srzx by updating 1D extrapolation
-            slzx = slz(i,j,k) 
+            slzx = slz(i,j,k,nc) 
                 - (dt6/hx)*(umac(i+1,j,k-1)+umac(i,j,k-1)) 
-                *(simhx(i+1,j,k-1)-simhx(i,j,k-1));
-            srzx = srz(i,j,k) 
+                *(simhx(i+1,j,k-1,nc)-simhx(i,j,k-1,nc));
+            srzx = srz(i,j,k,nc) 
                 - (dt6/hx)*(umac(i+1,j,k)+umac(i,j,k)) 
-                *(simhx(i+1,j,k)-simhx(i,j,k));
+                *(simhx(i+1,j,k,nc)-simhx(i,j,k,nc));
         }
 
         // impose lo side bc's
@@ -1363,44 +1458,46 @@ void Maestro::MakeEdgeScalTransverse(const MFIter& mfi,
         }
 
         // make simhzx by solving Riemann problem
-        simhzx(i,j,k) = (wmac(i,j,k) > 0.0) ?
+        simhzx(i,j,k,nc) = (wmac(i,j,k) > 0.0) ?
             slzx : srzx;
-        simhzx(i,j,k) = (fabs(wmac(i,j,k)) > rel_eps_local) ?
-            simhzx(i,j,k) : 0.5 * (slzx + srzx);
+        simhzx(i,j,k,nc) = (fabs(wmac(i,j,k)) > rel_eps_local) ?
+            simhzx(i,j,k,nc) : 0.5 * (slzx + srzx);
     });
 
     // simhzy
     // imhbox = mfi.grownnodaltilebox(2, IntVect(1,0,0));
-    imhbox = amrex::grow(mfi.tilebox(), 0, 1);
+    imhbox = amrex::grow(tileBox, 0, 1);
     imhbox = amrex::growHi(imhbox, 2, 1);
 
-    AMREX_PARALLEL_FOR_3D(imhbox, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(imhbox, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real slzy = 0.0;
         Real srzy = 0.0;
         // loop over appropriate zy faces
         if (is_conservative) {
             // make slzy, srzy by updating 1D extrapolation
-            slzy = slz(i,j,k) 
-                - (dt3/hy) * (simhy(i,j+1,k-1)*vmac(i,j+1,k-1) 
-                - simhy(i,j,k-1)*vmac(i,j,k-1)) 
+            slzy = slz(i,j,k,nc) 
+                - (dt3/hy) * (simhy(i,j+1,k-1,nc)*vmac(i,j+1,k-1) 
+                - simhy(i,j,k-1,nc)*vmac(i,j,k-1)) 
                 - dt3*scal(i,j,k-1,comp)*divu(i,j,k-1) 
                 + (dt3/hy)*scal(i,j,k-1,comp)*
                 (vmac(i,j+1,k-1)-vmac(i,j,k-1));
-            srzy = srz(i,j,k) 
-                - (dt3/hy)*(simhy(i,j+1,k)*vmac(i,j+1,k)
-                - simhy(i,j,k)*vmac(i,j,k)) 
+            srzy = srz(i,j,k,nc) 
+                - (dt3/hy)*(simhy(i,j+1,k,nc)*vmac(i,j+1,k)
+                - simhy(i,j,k,nc)*vmac(i,j,k)) 
                 - dt3*scal(i,j,k,comp)*divu(i,j,k) 
                 + (dt3/hy)*scal(i,j,k,comp)*
                 (vmac(i,j+1,k)-vmac(i,j,k));
         } else {
             // make slzy, srzy by updating 1D extrapolation
-            slzy = slz(i,j,k) 
+            slzy = slz(i,j,k,nc) 
                 - (dt6/hy)*(vmac(i,j+1,k-1)+vmac(i,j,k-1)) 
-                *(simhy(i,j+1,k-1)-simhy(i,j,k-1));
-            srzy = srz(i,j,k) 
+                *(simhy(i,j+1,k-1,nc)-simhy(i,j,k-1,nc));
+            srzy = srz(i,j,k,nc) 
                 - (dt6/hy)*(vmac(i,j+1,k)+vmac(i,j,k)) 
-                *(simhy(i,j+1,k)-simhy(i,j,k));
+                *(simhy(i,j+1,k,nc)-simhy(i,j,k,nc));
         }
 
         // impose lo side bc's
@@ -1439,14 +1536,15 @@ void Maestro::MakeEdgeScalTransverse(const MFIter& mfi,
         }
 
         // make simhzy by solving Riemann problem
-        simhzy(i,j,k) = (wmac(i,j,k) > 0.0) ?
+        simhzy(i,j,k,nc) = (wmac(i,j,k) > 0.0) ?
             slzy : srzy;
-        simhzy(i,j,k) = (fabs(wmac(i,j,k)) > rel_eps_local) ?
-            simhzy(i,j,k) : 0.5 * (slzy + srzy);
+        simhzy(i,j,k,nc) = (fabs(wmac(i,j,k)) > rel_eps_local) ?
+            simhzy(i,j,k,nc) : 0.5 * (slzy + srzy);
     });
 }
 
-void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
+void Maestro::MakeEdgeScalEdges(const Box& tileBox,
+                            const Box& validBox,
                             Array4<Real> const slx,
                             Array4<Real> const srx,
                             Array4<Real> const sly,
@@ -1472,7 +1570,7 @@ void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
                             const Box& domainBox,
                             const Vector<BCRec>& bcs,
                             const amrex::GpuArray<Real,AMREX_SPACEDIM> dx,
-                            int comp, int bccomp, 
+                            int start_comp, int bccomp, int ncomp, 
                             bool is_vel, bool is_conservative) 
 {
     // timer for profiling
@@ -1496,53 +1594,55 @@ void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
     const auto domlo = domainBox.loVect3d();
     const auto domhi = domainBox.hiVect3d();
 
-    const Box& xbx = mfi.nodaltilebox(0);
-    const Box& ybx = mfi.nodaltilebox(1);
-    const Box& zbx = mfi.nodaltilebox(2);
+    const Box& xbx = EdgeScalFaceBox(tileBox, validBox, 0);
+    const Box& ybx = EdgeScalFaceBox(tileBox, validBox, 1);
+    const Box& zbx = EdgeScalFaceBox(tileBox, validBox, 2);
 
     // x-direction
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
-    AMREX_PARALLEL_FOR_3D(xbx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(xbx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real sedgelx = 0.0;
         Real sedgerx = 0.0;
 
         Real fl = (ppm_trace_forces_local == 0) ? 
-            force(i-1,j,k,comp) : Ipf(i-1,j,k,0);
+            force(i-1,j,k,comp) : Ipf(i-1,j,k,nc);
         Real fr = (ppm_trace_forces_local == 0) ? 
-            force(i,j,k,comp) : Imf(i,j,k,0);
+            force(i,j,k,comp) : Imf(i,j,k,nc);
 
         // make sedgelx, sedgerx
         if (is_conservative) {
-            sedgelx = slx(i,j,k) 
-                - (dt2/hy)*(simhyz(i-1,j+1,k  )*vmac(i-1,j+1,k) 
-                - simhyz(i-1,j,k)*vmac(i-1,j,k)) 
-                - (dt2/hz)*(simhzy(i-1,j,k+1)*wmac(i-1,j,k+1) 
-                - simhzy(i-1,j,k)*wmac(i-1,j,k)) 
+            sedgelx = slx(i,j,k,nc) 
+                - (dt2/hy)*(simhyz(i-1,j+1,k  ,nc)*vmac(i-1,j+1,k) 
+                - simhyz(i-1,j,k,nc)*vmac(i-1,j,k)) 
+                - (dt2/hz)*(simhzy(i-1,j,k+1,nc)*wmac(i-1,j,k+1) 
+                - simhzy(i-1,j,k,nc)*wmac(i-1,j,k)) 
                 - (dt2/hx)*scal(i-1,j,k,comp)*(umac(i,j,k)-umac(i-1,j,k)) 
                 + dt2*fl;
 
-            sedgerx = srx(i,j,k) 
-                - (dt2/hy)*(simhyz(i,j+1,k)*vmac(i,j+1,k) 
-                - simhyz(i,j,k)*vmac(i,j,k)) 
-                - (dt2/hz)*(simhzy(i,j,k+1)*wmac(i,j,k+1) 
-                - simhzy(i,j,k)*wmac(i,j,k)) 
+            sedgerx = srx(i,j,k,nc) 
+                - (dt2/hy)*(simhyz(i,j+1,k,nc)*vmac(i,j+1,k) 
+                - simhyz(i,j,k,nc)*vmac(i,j,k)) 
+                - (dt2/hz)*(simhzy(i,j,k+1,nc)*wmac(i,j,k+1) 
+                - simhzy(i,j,k,nc)*wmac(i,j,k)) 
                 - (dt2/hx)*scal(i,j,k,comp)*(umac(i+1,j,k)-umac(i,j,k)) 
                 + dt2*fr;
         } else {
-            sedgelx = slx(i,j,k) 
+            sedgelx = slx(i,j,k,nc) 
                 - (dt4/hy)*(vmac(i-1,j+1,k)+vmac(i-1,j,k))* 
-                (simhyz(i-1,j+1,k)-simhyz(i-1,j,k)) 
+                (simhyz(i-1,j+1,k,nc)-simhyz(i-1,j,k,nc)) 
                 - (dt4/hz)*(wmac(i-1,j,k+1)+wmac(i-1,j,k))* 
-                (simhzy(i-1,j,k+1)-simhzy(i-1,j,k)) 
+                (simhzy(i-1,j,k+1,nc)-simhzy(i-1,j,k,nc)) 
                 + dt2*fl;
 
-            sedgerx = srx(i,j,k) 
+            sedgerx = srx(i,j,k,nc) 
                 - (dt4/hy)*(vmac(i,j+1,k)+vmac(i,j,k))* 
-                (simhyz(i,j+1,k)-simhyz(i,j,k)) 
+                (simhyz(i,j+1,k,nc)-simhyz(i,j,k,nc)) 
                 - (dt4/hz)*(wmac(i,j,k+1)+wmac(i,j,k))* 
-                (simhzy(i,j,k+1)-simhzy(i,j,k)) 
+                (simhzy(i,j,k+1,nc)-simhzy(i,j,k,nc)) 
                 + dt2*fr;
         } 
 
@@ -1590,46 +1690,48 @@ void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
     // y-direction
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
-    AMREX_PARALLEL_FOR_3D(ybx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(ybx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real sedgely = 0.0;
         Real sedgery = 0.0;
 
         Real fl = (ppm_trace_forces_local == 0) ? 
-            force(i,j-1,k,comp) : Ipf(i,j-1,k,1);
+            force(i,j-1,k,comp) : Ipf(i,j-1,k,ncomp+nc);
         Real fr = (ppm_trace_forces_local == 0) ? 
-            force(i,j,k,comp) : Imf(i,j,k,1);
+            force(i,j,k,comp) : Imf(i,j,k,ncomp+nc);
 
         // make sedgely, sedgery
         if (is_conservative) {
-            sedgely = sly(i,j,k) 
-                - (dt2/hx)*(simhxz(i+1,j-1,k  )*umac(i+1,j-1,k) 
-                - simhxz(i,j-1,k)*umac(i,j-1,k)) 
-                - (dt2/hz)*(simhzx(i,j-1,k+1)*wmac(i,j-1,k+1) 
-                - simhzx(i,j-1,k)*wmac(i,j-1,k)) 
+            sedgely = sly(i,j,k,nc) 
+                - (dt2/hx)*(simhxz(i+1,j-1,k  ,nc)*umac(i+1,j-1,k) 
+                - simhxz(i,j-1,k,nc)*umac(i,j-1,k)) 
+                - (dt2/hz)*(simhzx(i,j-1,k+1,nc)*wmac(i,j-1,k+1) 
+                - simhzx(i,j-1,k,nc)*wmac(i,j-1,k)) 
                 - (dt2/hy)*scal(i,j-1,k,comp)*(vmac(i,j,k)-vmac(i,j-1,k)) 
                 + dt2*fl;
 
-            sedgery = sry(i,j,k) 
-                - (dt2/hx)*(simhxz(i+1,j,k)*umac(i+1,j,k) 
-                - simhxz(i,j,k)*umac(i,j,k)) 
-                - (dt2/hz)*(simhzx(i,j,k+1)*wmac(i,j,k+1) 
-                - simhzx(i,j,k)*wmac(i,j,k)) 
+            sedgery = sry(i,j,k,nc) 
+                - (dt2/hx)*(simhxz(i+1,j,k,nc)*umac(i+1,j,k) 
+                - simhxz(i,j,k,nc)*umac(i,j,k)) 
+                - (dt2/hz)*(simhzx(i,j,k+1,nc)*wmac(i,j,k+1) 
+                - simhzx(i,j,k,nc)*wmac(i,j,k)) 
                 - (dt2/hy)*scal(i,j,k,comp)*(vmac(i,j+1,k)-vmac(i,j,k)) 
                 + dt2*fr;
         } else {
-            sedgely = sly(i,j,k) 
+            sedgely = sly(i,j,k,nc) 
                 - (dt4/hx)*(umac(i+1,j-1,k)+umac(i,j-1,k))* 
-                (simhxz(i+1,j-1,k)-simhxz(i,j-1,k)) 
+                (simhxz(i+1,j-1,k,nc)-simhxz(i,j-1,k,nc)) 
                 - (dt4/hz)*(wmac(i,j-1,k+1)+wmac(i,j-1,k))* 
-                (simhzx(i,j-1,k+1)-simhzx(i,j-1,k)) 
+                (simhzx(i,j-1,k+1,nc)-simhzx(i,j-1,k,nc)) 
                 + dt2*fl;
 
-            sedgery = sry(i,j,k) 
+            sedgery = sry(i,j,k,nc) 
                 - (dt4/hx)*(umac(i+1,j,k)+umac(i,j,k))* 
-                (simhxz(i+1,j,k)-simhxz(i,j,k)) 
+                (simhxz(i+1,j,k,nc)-simhxz(i,j,k,nc)) 
                 - (dt4/hz)*(wmac(i,j,k+1)+wmac(i,j,k))* 
-                (simhzx(i,j,k+1)-simhzx(i,j,k)) 
+                (simhzx(i,j,k+1,nc)-simhzx(i,j,k,nc)) 
                 + dt2*fr;
         } 
 
@@ -1677,46 +1779,48 @@ void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
     // z-direction
     bclo = bcs[bccomp].lo()[2];
     bchi = bcs[bccomp].hi()[2];
-    AMREX_PARALLEL_FOR_3D(zbx, i, j, k, 
+    AMREX_PARALLEL_FOR_4D(zbx, ncomp, i, j, k, nc,
     {
+        const int comp = start_comp + nc;
+
         Real sedgelz = 0.0;
         Real sedgerz = 0.0;
 
         Real fl = (ppm_trace_forces_local == 0) ? 
-            force(i,j,k-1,comp) : Ipf(i,j,k-1,2);
+            force(i,j,k-1,comp) : Ipf(i,j,k-1,2*ncomp+nc);
         Real fr = (ppm_trace_forces_local == 0) ? 
-            force(i,j,k,comp) : Imf(i,j,k,2);
+            force(i,j,k,comp) : Imf(i,j,k,2*ncomp+nc);
 
         // make sedgelz, sedgerz
         if (is_conservative) {
-            sedgelz = slz(i,j,k) 
-                - (dt2/hx)*(simhxy(i+1,j,k-1)*umac(i+1,j,k-1) 
-                - simhxy(i,j,k-1)*umac(i,j,k-1)) 
-                - (dt2/hy)*(simhyx(i,j+1,k-1)*vmac(i,j+1,k-1) 
-                - simhyx(i,j,k-1)*vmac(i,j,k-1)) 
+            sedgelz = slz(i,j,k,nc) 
+                - (dt2/hx)*(simhxy(i+1,j,k-1,nc)*umac(i+1,j,k-1) 
+                - simhxy(i,j,k-1,nc)*umac(i,j,k-1)) 
+                - (dt2/hy)*(simhyx(i,j+1,k-1,nc)*vmac(i,j+1,k-1) 
+                - simhyx(i,j,k-1,nc)*vmac(i,j,k-1)) 
                 - (dt2/hz)*scal(i,j,k-1,comp)*(wmac(i,j,k)-wmac(i,j,k-1)) 
                 + dt2*fl;
 
-            sedgerz = srz(i,j,k) 
-                - (dt2/hx)*(simhxy(i+1,j,k)*umac(i+1,j,k) 
-                - simhxy(i,j,k)*umac(i,j,k)) 
-                - (dt2/hy)*(simhyx(i,j+1,k)*vmac(i,j+1,k) 
-                - simhyx(i,j,k)*vmac(i,j,k)) 
+            sedgerz = srz(i,j,k,nc) 
+                - (dt2/hx)*(simhxy(i+1,j,k,nc)*umac(i+1,j,k) 
+                - simhxy(i,j,k,nc)*umac(i,j,k)) 
+                - (dt2/hy)*(simhyx(i,j+1,k,nc)*vmac(i,j+1,k) 
+                - simhyx(i,j,k,nc)*vmac(i,j,k)) 
                 - (dt2/hz)*scal(i,j,k,comp)*(wmac(i,j,k+1)-wmac(i,j,k)) 
                 + dt2*fr;
         } else {
-            sedgelz = slz(i,j,k) 
+            sedgelz = slz(i,j,k,nc) 
                 - (dt4/hx)*(umac(i+1,j,k-1)+umac(i,j,k-1))* 
-                (simhxy(i+1,j,k-1)-simhxy(i,j,k-1)) 
+                (simhxy(i+1,j,k-1,nc)-simhxy(i,j,k-1,nc)) 
                 - (dt4/hy)*(vmac(i,j+1,k-1)+vmac(i,j,k-1))* 
-                (simhyx(i,j+1,k-1)-simhyx(i,j,k-1)) 
+                (simhyx(i,j+1,k-1,nc)-simhyx(i,j,k-1,nc)) 
                 + dt2*fl;
 
-            sedgerz = srz(i,j,k) 
+            sedgerz = srz(i,j,k,nc) 
                 - (dt4/hx)*(umac(i+1,j,k)+umac(i,j,k))* 
-                (simhxy(i+1,j,k)-simhxy(i,j,k)) 
+                (simhxy(i+1,j,k,nc)-simhxy(i,j,k,nc)) 
                 - (dt4/hy)*(vmac(i,j+1,k)+vmac(i,j,k))* 
-                (simhyx(i,j+1,k)-simhyx(i,j,k)) 
+                (simhyx(i,j+1,k,nc)-simhyx(i,j,k,nc)) 
                 + dt2*fr;
         } 
 
@@ -1763,3 +1867,20 @@ void Maestro::MakeEdgeScalEdges(const MFIter& mfi,
 }
 
 #endif
+
+void
+Maestro::SelectEdgeScalKernels ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SelectEdgeScalKernels()", SelectEdgeScalKernels);
+
+    // the predictor only distinguishes slopes from PPM, so ppm_type 2
+    // shares the instance for 1
+    if (ppm_type == 0) {
+        make_edge_scal_predictor = &Maestro::MakeEdgeScalPredictor<0>;
+    } else if (ppm_type == 1 || ppm_type == 2) {
+        make_edge_scal_predictor = &Maestro::MakeEdgeScalPredictor<1>;
+    } else {
+        Abort("SelectEdgeScalKernels: invalid ppm_type");
+    }
+}
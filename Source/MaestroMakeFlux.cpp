@@ -1,5 +1,6 @@
 
 #include <Maestro.H>
+#include <MaestroScalUpdate.H>
 
 using namespace amrex;
 
@@ -15,26 +16,29 @@ const int pred_rhoprime_and_X   = 1;
 const int pred_rhoX             = 2;
 const int pred_rho_and_X        = 3;
 
+template <int spt>
 void
-Maestro::MakeRhoXFlux (const Vector<MultiFab>& state,
-                       Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sflux,
-                       Vector<MultiFab>& etarhoflux,
-                       Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& w0mac,
-                       const BaseState<Real>& rho0_old_in,
-                       const BaseState<Real>& rho0_edge_old_state,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_old,
-                       const BaseState<Real>& rho0_new_in,
-                       const BaseState<Real>& rho0_edge_new_state,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_new,
-                       const BaseState<Real>& rho0_predicted_edge_state,
-                       int start_comp, int num_comp)
+Maestro::MakeRhoXFluxT (const Vector<MultiFab>& state,
+                        Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sflux,
+                        Vector<MultiFab>& etarhoflux,
+                        Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& w0mac,
+                        const BaseState<Real>& rho0_old_in,
+                        const BaseState<Real>& rho0_edge_old_state,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_old,
+                        const BaseState<Real>& rho0_new_in,
+                        const BaseState<Real>& rho0_edge_new_state,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_new,
+                        const BaseState<Real>& rho0_predicted_edge_state,
+                        int start_comp, int num_comp)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeRhoXFlux()", MakeRhoXFlux);
 
-    const int species_pred_type_loc = species_pred_type;
+    // species_pred_type is a template parameter, so the tests of it in
+    // the kernels below are resolved at compile time
+    constexpr int species_pred_type_loc = spt;
     const bool use_exact_base_state_loc = use_exact_base_state;
     const bool evolve_base_state_loc = evolve_base_state;
 
@@ -418,40 +422,44 @@ Maestro::MakeRhoXFlux (const Vector<MultiFab>& state,
     // Something analogous to edge_restriction is done in UpdateScal()
 }
 
+template <int spt, int ept>
 void
-Maestro::MakeRhoHFlux (const Vector<MultiFab>& state,
-                       Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sflux,
-                       Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& w0mac,
-                       const BaseState<Real>& rho0_old_in,
-                       const BaseState<Real>& rho0_edge_old,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_old,
-                       const BaseState<Real>& rho0_new_in,
-                       const BaseState<Real>& rho0_edge_new,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_new,
-                       const BaseState<Real>& rhoh0_old_in,
-                       const BaseState<Real>& rhoh0_edge_old,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& rh0mac_old,
-                       const BaseState<Real>& rhoh0_new_in,
-                       const BaseState<Real>& rhoh0_edge_new,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& rh0mac_new,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& h0mac_old,
-                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& h0mac_new)
+Maestro::MakeRhoHFluxT (const Vector<MultiFab>& state,
+                        Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sflux,
+                        Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& w0mac,
+                        const BaseState<Real>& rho0_old_in,
+                        const BaseState<Real>& rho0_edge_old,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_old,
+                        const BaseState<Real>& rho0_new_in,
+                        const BaseState<Real>& rho0_edge_new,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_new,
+                        const BaseState<Real>& rhoh0_old_in,
+                        const BaseState<Real>& rhoh0_edge_old,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& rh0mac_old,
+                        const BaseState<Real>& rhoh0_new_in,
+                        const BaseState<Real>& rhoh0_edge_new,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& rh0mac_new,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& h0mac_old,
+                        const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& h0mac_new)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeRhoHFlux()", MakeRhoHFlux);
 
-    const bool have_h = enthalpy_pred_type == pred_h ||
-                        enthalpy_pred_type == pred_T_then_h || 
-                        enthalpy_pred_type == pred_Tprime_then_h;
+    // species_pred_type and enthalpy_pred_type are template parameters,
+    // so the tests of them in the kernels below are resolved at compile
+    // time
+    constexpr bool have_h = ept == pred_h ||
+                            ept == pred_T_then_h ||
+                            ept == pred_Tprime_then_h;
 #if (AMREX_SPACEDIM == 3)
-    const bool have_hprime = enthalpy_pred_type == pred_hprime;
+    constexpr bool have_hprime = ept == pred_hprime;
 #endif
-    const bool have_rhoh = enthalpy_pred_type == pred_rhoh;
+    constexpr bool have_rhoh = ept == pred_rhoh;
 
-    const int species_pred_type_loc = species_pred_type;
-    const int enthalpy_pred_type_loc = enthalpy_pred_type;
+    constexpr int species_pred_type_loc = spt;
+    constexpr int enthalpy_pred_type_loc = ept;
 
     for (int lev=0; lev<=finest_level; ++lev) {
 
@@ -930,3 +938,639 @@ Maestro::MakeRhoHFlux (const Vector<MultiFab>& state,
 
     // Something analogous to edge_restriction is done in UpdateScal()
 }
+
+namespace {
+
+    // the (rho X) fluxes through the faces in fbx for species_pred_type
+    // spt, as MakeRhoXFluxT computes them: species n in component
+    // FirstSpec+n of flux and their sum in component Rho.  The base state
+    // density on the faces is the average of rho0_a and rho0_b.
+    template <int spt>
+    void RhoXFluxes (const Box& fbx, const int lev,
+                     const Array4<Real>& flux,
+                     const Array4<const Real>& sedge,
+                     const Array4<const Real>& vel,
+                     const BaseStateArray<const Real>& rho0_a,
+                     const BaseStateArray<const Real>& rho0_b)
+    {
+        AMREX_PARALLEL_FOR_3D(fbx, i, j, k, {
+#if (AMREX_SPACEDIM == 2)
+            Real rho0_edge = 0.5*(rho0_a(lev,j)+rho0_b(lev,j));
+#else
+            Real rho0_edge = 0.5*(rho0_a(lev,k)+rho0_b(lev,k));
+#endif
+            flux(i,j,k,Rho) = 0.0;
+
+            for (int comp = FirstSpec; comp < FirstSpec+NumSpec; ++comp) {
+                if (spt == pred_rhoprime_and_X) {
+                    // edge states are rho' and X.  To make the (rho X) flux,
+                    // we need the edge state of rho0
+                    flux(i,j,k,comp) = vel(i,j,k)*
+                        (rho0_edge+sedge(i,j,k,Rho))*sedge(i,j,k,comp);
+
+                } else if (spt == pred_rhoX) {
+                    // edge states are (rho X)
+                    flux(i,j,k,comp) = vel(i,j,k)*sedge(i,j,k,comp);
+
+                } else if (spt == pred_rho_and_X) {
+                    // edge states are rho and X
+                    flux(i,j,k,comp) = vel(i,j,k)*
+                        sedge(i,j,k,Rho)*sedge(i,j,k,comp);
+                }
+
+                // compute the density fluxes by summing the species fluxes
+                flux(i,j,k,Rho) += flux(i,j,k,comp);
+            }
+        });
+    }
+}
+
+void
+Maestro::UpdateRhoXFused (Vector<MultiFab>& stateold,
+                          Vector<MultiFab>& statenew,
+                          Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sflux,
+                          Vector<MultiFab>& etarhoflux,
+                          Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
+                          Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
+                          const BaseState<Real>& rho0_old_in,
+                          const BaseState<Real>& rho0_edge_old_state,
+                          const BaseState<Real>& rho0_new_in,
+                          const BaseState<Real>& rho0_edge_new_state,
+                          const BaseState<Real>& rho0_predicted_edge_state,
+                          Vector<MultiFab>& force)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::UpdateRhoXFused()", UpdateRhoXFused);
+
+    if (spherical) {
+        Abort("UpdateRhoXFused: not supported for spherical");
+    }
+
+    const int species_pred_type_loc = species_pred_type;
+    const bool etarho_loc = evolve_base_state && !use_exact_base_state;
+    const Real dt_loc = dt;
+
+    // the edge states of the species are only needed outside this pass to
+    // make the edge states of (rho h) from T
+    const bool keep_X_edges = enthalpy_pred_type == pred_T_then_rhohprime ||
+        enthalpy_pred_type == pred_T_then_h ||
+        enthalpy_pred_type == pred_Tprime_then_h;
+    const int nspec_out = keep_X_edges ? NumSpec : 0;
+
+    const auto rho0_old_arr = rho0_old_in.const_array();
+    const auto rho0_new_arr = rho0_new_in.const_array();
+
+    const auto rho0_edge_old = rho0_edge_old_state.const_array();
+    const auto rho0_edge_new = rho0_edge_new_state.const_array();
+    const auto rho0_predicted_edge = rho0_predicted_edge_state.const_array();
+
+    const auto w0_arr = w0.const_array();
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+
+        const auto dx = geom[lev].CellSizeArray();
+
+        // after the update, the fluxes are only needed by the flux registers
+        const bool write_sflux = reflux_type == 2 && (flux_reg_s[lev+1] || flux_reg_s[lev]);
+
+        // as in MakeEdgeScal, if the ghost cells of the state are still
+        // being exchanged, the tiles are split in two and the shell of
+        // cells near the box boundaries is done once the exchange is done
+        const int ng_scal = stateold[lev].nGrow();
+        const bool split_tiles = async_fill.mf == &stateold[lev];
+
+        for (int pass = 0; pass < (split_tiles ? 2 : 1); ++pass) {
+
+            if (pass == 1) {
+                FillPatchFinish();
+            }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                EdgeScalScratch scratch;
+
+                // the edge states and fluxes through the faces of a part of
+                // a tile, laid out like sedge and sflux (species in
+                // FirstSpec.., density in Rho)
+                std::array< FArrayBox, AMREX_SPACEDIM > edge;
+                std::array< FArrayBox, AMREX_SPACEDIM > flux;
+
+                // the old density and (rho X) of a part, if stateold holds X
+                FArrayBox sold_fab;
+
+                Vector<Elixir> elixirs;
+
+                for (MFIter mfi(stateold[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+                    for (const Box& bx : EdgeScalParts(mfi, ng_scal, split_tiles, pass)) {
+
+                        elixirs.clear();
+
+                        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                            edge[d].resize(amrex::surroundingNodes(bx, d), FirstSpec+NumSpec);
+                            elixirs.push_back(edge[d].elixir());
+                        }
+
+                        const std::array< Array4<Real>, AMREX_SPACEDIM > edge_arr {{
+                            AMREX_D_DECL(edge[0].array(), edge[1].array(), edge[2].array()) }};
+
+                        // predict X or (rho X) and rho or rho' to all the
+                        // faces of the part, including the ones it shares
+                        // with its neighbours
+                        if (species_pred_type_loc == pred_rhoprime_and_X ||
+                            species_pred_type_loc == pred_rho_and_X) {
+
+                            MakeEdgeScalBox(mfi, bx, bx, lev, stateold[lev], edge_arr,
+                                            umac[lev], force[lev], 0, bcs_s,
+                                            FirstSpec, FirstSpec, NumSpec, 0, true, scratch);
+
+                            MakeEdgeScalBox(mfi, bx, bx, lev, stateold[lev], edge_arr,
+                                            umac[lev], force[lev], 0, bcs_s,
+                                            Rho, Rho, 1, 0, false, scratch);
+
+                        } else if (species_pred_type_loc == pred_rhoX) {
+
+                            MakeEdgeScalBox(mfi, bx, bx, lev, stateold[lev], edge_arr,
+                                            umac[lev], force[lev], 0, bcs_s,
+                                            FirstSpec, FirstSpec, NumSpec, 1, true, scratch);
+
+                            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                                const Array4<Real> e = edge_arr[d];
+                                AMREX_PARALLEL_FOR_3D(amrex::surroundingNodes(bx, d), i, j, k, {
+                                    e(i,j,k,Rho) = e(i,j,k,FirstSpec);
+                                    for (int comp = FirstSpec+1; comp < FirstSpec+NumSpec; ++comp) {
+                                        e(i,j,k,Rho) += e(i,j,k,comp);
+                                    }
+                                });
+                            }
+                        }
+
+                        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+
+                            const Box& fbx = amrex::surroundingNodes(bx, d);
+
+                            flux[d].resize(fbx, FirstSpec+NumSpec);
+                            elixirs.push_back(flux[d].elixir());
+
+                            const Array4<Real> flux_arr = flux[d].array();
+                            const Array4<const Real> sedge_arr = edge[d].const_array();
+                            const Array4<const Real> vel_arr = umac[lev][d].const_array(mfi);
+
+                            // the base state density is edge-centered on the
+                            // faces normal to the radial direction
+                            const bool radial = d == AMREX_SPACEDIM-1;
+                            const auto rho0_a = radial ? rho0_edge_old : rho0_old_arr;
+                            const auto rho0_b = radial ? rho0_edge_new : rho0_new_arr;
+
+                            if (species_pred_type_loc == pred_rhoprime_and_X) {
+                                RhoXFluxes<pred_rhoprime_and_X>(fbx, lev, flux_arr, sedge_arr,
+                                                                vel_arr, rho0_a, rho0_b);
+                            } else if (species_pred_type_loc == pred_rhoX) {
+                                RhoXFluxes<pred_rhoX>(fbx, lev, flux_arr, sedge_arr,
+                                                      vel_arr, rho0_a, rho0_b);
+                            } else if (species_pred_type_loc == pred_rho_and_X) {
+                                RhoXFluxes<pred_rho_and_X>(fbx, lev, flux_arr, sedge_arr,
+                                                           vel_arr, rho0_a, rho0_b);
+                            }
+
+                            // the faces this part owns, which are the only
+                            // ones it writes outside its buffers
+                            const Box& nbx = EdgeScalFaceBox(bx, mfi.validbox(), d);
+
+                            // EnthalpyAdvance still needs the edge states of
+                            // rho (and of X, if it predicts T)
+                            const Array4<Real> sedge_out = sedge[lev][d].array(mfi);
+
+                            AMREX_PARALLEL_FOR_3D(nbx, i, j, k, {
+                                sedge_out(i,j,k,Rho) = sedge_arr(i,j,k,Rho);
+                                for (int comp = FirstSpec; comp < FirstSpec+nspec_out; ++comp) {
+                                    sedge_out(i,j,k,comp) = sedge_arr(i,j,k,comp);
+                                }
+                            });
+
+                            if (radial && etarho_loc) {
+                                const Array4<Real> etarhoflux_arr = etarhoflux[lev].array(mfi);
+
+                                AMREX_PARALLEL_FOR_3D(nbx, i, j, k, {
+#if (AMREX_SPACEDIM == 2)
+                                    const int r = j;
+#else
+                                    const int r = k;
+#endif
+                                    for (int comp = FirstSpec; comp < FirstSpec+NumSpec; ++comp) {
+                                        etarhoflux_arr(i,j,k) += flux_arr(i,j,k,comp);
+                                    }
+                                    etarhoflux_arr(i,j,k) -= w0_arr(lev,r)*rho0_predicted_edge(lev,r);
+                                });
+                            }
+
+                            if (write_sflux) {
+                                const Array4<Real> sflux_arr = sflux[lev][d].array(mfi);
+
+                                AMREX_PARALLEL_FOR_3D(nbx, i, j, k, {
+                                    sflux_arr(i,j,k,Rho) = flux_arr(i,j,k,Rho);
+                                    for (int comp = FirstSpec; comp < FirstSpec+NumSpec; ++comp) {
+                                        sflux_arr(i,j,k,comp) = flux_arr(i,j,k,comp);
+                                    }
+                                });
+                            }
+                        }
+
+                        // the update needs the old rho and (rho X).  If
+                        // stateold holds X (and rho'), rebuild them for the
+                        // part the same way DensityAdvance converts stateold
+                        // back afterwards
+                        Array4<const Real> sold_arr = stateold[lev].const_array(mfi);
+
+                        if (species_pred_type_loc == pred_rhoprime_and_X ||
+                            species_pred_type_loc == pred_rho_and_X) {
+
+                            sold_fab.resize(bx, FirstSpec+NumSpec);
+                            elixirs.push_back(sold_fab.elixir());
+
+                            const Array4<const Real> s = stateold[lev].const_array(mfi);
+                            const Array4<Real> rhox = sold_fab.array();
+                            const bool pert_rho = species_pred_type_loc == pred_rhoprime_and_X;
+
+                            AMREX_PARALLEL_FOR_3D(bx, i, j, k, {
+#if (AMREX_SPACEDIM == 2)
+                                const int r = j;
+#else
+                                const int r = k;
+#endif
+                                rhox(i,j,k,Rho) = pert_rho ? s(i,j,k,Rho) + rho0_old_arr(lev,r)
+                                                           : s(i,j,k,Rho);
+                                for (int comp = FirstSpec; comp < FirstSpec+NumSpec; ++comp) {
+                                    rhox(i,j,k,comp) = s(i,j,k,comp) * rhox(i,j,k,Rho);
+                                }
+                            });
+
+                            sold_arr = sold_fab.const_array();
+                        }
+
+                        const Array4<Real> snew_arr = statenew[lev].array(mfi);
+                        const Array4<const Real> fluxx = flux[0].const_array();
+                        const Array4<const Real> fluxy = flux[1].const_array();
+#if (AMREX_SPACEDIM == 3)
+                        const Array4<const Real> fluxz = flux[2].const_array();
+#else
+                        const Array4<const Real> fluxz;
+#endif
+                        // the force for (rho X)_i at time n+1/2 is zero, as
+                        // is the force used to predict them
+                        const Array4<const Real> force_arr = force[lev].array(mfi);
+
+                        AMREX_PARALLEL_FOR_4D(bx, NumSpec, i, j, k, n, {
+                            UpdateRhoXCell(i, j, k, FirstSpec+n, sold_arr, snew_arr,
+                                           fluxx, fluxy, fluxz, force_arr, dx, dt_loc);
+                        });
+
+                        AMREX_PARALLEL_FOR_3D(bx, i, j, k, {
+                            UpdateRhoCell(i, j, k, sold_arr, snew_arr);
+                        });
+                    } // end loop over parts
+                } // end MFIter loop
+            } // end omp parallel region
+        } // end loop over passes
+
+        // increment or decrement the flux registers by area and time-weighted
+        // fluxes, as in MakeRhoXFlux
+        if (write_sflux) {
+
+            // Get the grid size
+            const Real* dxr = geom[lev].CellSize();
+            // NOTE: areas are different in DIM=2 and DIM=3
+#if (AMREX_SPACEDIM == 3)
+            const Real area[3] = {dxr[1]*dxr[2], dxr[0]*dxr[2], dxr[0]*dxr[1]};
+#else
+            const Real area[2] = {dxr[1], dxr[0]};
+#endif
+
+            if (flux_reg_s[lev+1]) {
+                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                    // update the lev+1/lev flux register (index lev+1)
+                    flux_reg_s[lev+1]->CrseInit(sflux[lev][i],i,FirstSpec,FirstSpec,NumSpec, -1.0*dt*area[i]);
+                    // also include density flux
+                    flux_reg_s[lev+1]->CrseInit(sflux[lev][i],i,Rho,Rho,1, -1.0*dt*area[i]);
+                }
+            }
+            if (flux_reg_s[lev]) {
+                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                    // update the lev/lev-1 flux register (index lev)
+                    flux_reg_s[lev]->FineAdd(sflux[lev][i],i,FirstSpec,FirstSpec,NumSpec, 1.0*dt*area[i]);
+                    // also include density flux
+                    flux_reg_s[lev]->FineAdd(sflux[lev][i],i,Rho,Rho,1, 1.0*dt*area[i]);
+                }
+            }
+        }
+    } // end loop over levels
+
+    SyncScal(statenew, FirstSpec, NumSpec);
+}
+
+namespace {
+
+    // the (rho h) flux through the faces in fbx, as MakeRhoHFluxT<spt,ept>
+    // computes it on Cartesian grids, in component 0 of flux.  The base
+    // state density and (rho h) on the faces are the averages of rho0_a,
+    // rho0_b and of rhoh0_a, rhoh0_b.
+    template <int spt, int ept>
+    void RhoHFluxes (const Box& fbx, const int lev,
+                     const Array4<Real>& flux,
+                     const Array4<const Real>& sedge,
+                     const Array4<const Real>& vel,
+                     const BaseStateArray<const Real>& rho0_a,
+                     const BaseStateArray<const Real>& rho0_b,
+                     const BaseStateArray<const Real>& rhoh0_a,
+                     const BaseStateArray<const Real>& rhoh0_b)
+    {
+        AMREX_PARALLEL_FOR_3D(fbx, i, j, k, {
+#if (AMREX_SPACEDIM == 2)
+            const int r = j;
+#else
+            const int r = k;
+#endif
+            if (ept == pred_h) {
+                // enthalpy edge state is h
+                if (spt == pred_rhoprime_and_X) {
+                    // density edge state is rho'
+                    Real rho0_edge = 0.5*(rho0_a(lev,r)+rho0_b(lev,r));
+
+                    flux(i,j,k,0) = vel(i,j,k)*(rho0_edge+sedge(i,j,k,Rho))*sedge(i,j,k,RhoH);
+                } else {
+                    // density edge state is rho
+                    flux(i,j,k,0) = vel(i,j,k)*sedge(i,j,k,Rho)*sedge(i,j,k,RhoH);
+                }
+            } else if (ept == pred_rhoh) {
+                flux(i,j,k,0) = vel(i,j,k)*sedge(i,j,k,RhoH);
+
+            } else if (ept == pred_rhohprime) {
+                // enthalpy edge state is (rho h)'
+                Real rhoh0_edge = 0.5*(rhoh0_a(lev,r)+rhoh0_b(lev,r));
+
+                flux(i,j,k,0) = vel(i,j,k)*(rhoh0_edge+sedge(i,j,k,RhoH));
+            }
+        });
+    }
+}
+
+void
+Maestro::UpdateRhoHFused (const Vector<MultiFab>& stateold,
+                          Vector<MultiFab>& statenew,
+                          Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sflux,
+                          const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
+                          const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
+                          const BaseState<Real>& rho0_old_in,
+                          const BaseState<Real>& rho0_edge_old_state,
+                          const BaseState<Real>& rho0_new_in,
+                          const BaseState<Real>& rho0_edge_new_state,
+                          const BaseState<Real>& rhoh0_old_in,
+                          const BaseState<Real>& rhoh0_edge_old_state,
+                          const BaseState<Real>& rhoh0_new_in,
+                          const BaseState<Real>& rhoh0_edge_new_state,
+                          const Vector<MultiFab>& force,
+                          const Vector<MultiFab>& p0_cart)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::UpdateRhoHFused()", UpdateRhoHFused);
+
+    if (spherical) {
+        Abort("UpdateRhoHFused: not supported for spherical");
+    }
+    if (enthalpy_pred_type == pred_hprime) {
+        Abort("UpdateRhoHFused: predict_hprime not supported");
+    }
+
+    // the flux only depends on which quantity the enthalpy edge state is,
+    // and, for an h edge state, on whether the density edge state is rho'
+    const int species_pred_type_loc = species_pred_type;
+    const int enthalpy_pred_type_loc = enthalpy_pred_type;
+    const bool rhohprime_loc = enthalpy_pred_type_loc == pred_rhohprime ||
+                               enthalpy_pred_type_loc == pred_T_then_rhohprime;
+    const Real dt_loc = dt;
+
+    const auto rho0_old_arr = rho0_old_in.const_array();
+    const auto rho0_new_arr = rho0_new_in.const_array();
+    const auto rho0_edge_old = rho0_edge_old_state.const_array();
+    const auto rho0_edge_new = rho0_edge_new_state.const_array();
+
+    const auto rhoh0_old_arr = rhoh0_old_in.const_array();
+    const auto rhoh0_new_arr = rhoh0_new_in.const_array();
+    const auto rhoh0_edge_old = rhoh0_edge_old_state.const_array();
+    const auto rhoh0_edge_new = rhoh0_edge_new_state.const_array();
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+
+        const auto dx = geom[lev].CellSizeArray();
+
+        // after the update, the fluxes are only needed by the flux registers
+        const bool write_sflux = reflux_type == 2 && (flux_reg_s[lev+1] || flux_reg_s[lev]);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // the (rho h) fluxes through the faces of a tile
+            std::array< FArrayBox, AMREX_SPACEDIM > flux;
+
+            Vector<Elixir> elixirs;
+
+            for (MFIter mfi(stateold[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+                // Get the index space of the valid region
+                const Box& tileBox = mfi.tilebox();
+
+                elixirs.clear();
+
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+
+                    // all the faces of the tile, including the ones it
+                    // shares with its neighbours
+                    const Box& fbx = amrex::surroundingNodes(tileBox, d);
+
+                    flux[d].resize(fbx, 1);
+                    elixirs.push_back(flux[d].elixir());
+
+                    const Array4<Real> flux_arr = flux[d].array();
+                    const Array4<const Real> sedge_arr = sedge[lev][d].const_array(mfi);
+                    const Array4<const Real> vel_arr = umac[lev][d].const_array(mfi);
+
+                    // the base state is edge-centered on the faces normal
+                    // to the radial direction
+                    const bool radial = d == AMREX_SPACEDIM-1;
+                    const auto rho0_a = radial ? rho0_edge_old : rho0_old_arr;
+                    const auto rho0_b = radial ? rho0_edge_new : rho0_new_arr;
+                    const auto rhoh0_a = radial ? rhoh0_edge_old : rhoh0_old_arr;
+                    const auto rhoh0_b = radial ? rhoh0_edge_new : rhoh0_new_arr;
+
+                    if (enthalpy_pred_type_loc == pred_rhoh) {
+                        RhoHFluxes<pred_rhoX, pred_rhoh>(fbx, lev, flux_arr, sedge_arr, vel_arr,
+                                                         rho0_a, rho0_b, rhoh0_a, rhoh0_b);
+                    } else if (rhohprime_loc) {
+                        RhoHFluxes<pred_rhoX, pred_rhohprime>(fbx, lev, flux_arr, sedge_arr, vel_arr,
+                                                              rho0_a, rho0_b, rhoh0_a, rhoh0_b);
+                    } else if (species_pred_type_loc == pred_rhoprime_and_X) {
+                        RhoHFluxes<pred_rhoprime_and_X, pred_h>(fbx, lev, flux_arr, sedge_arr, vel_arr,
+                                                                rho0_a, rho0_b, rhoh0_a, rhoh0_b);
+                    } else {
+                        RhoHFluxes<pred_rhoX, pred_h>(fbx, lev, flux_arr, sedge_arr, vel_arr,
+                                                      rho0_a, rho0_b, rhoh0_a, rhoh0_b);
+                    }
+
+                    if (write_sflux) {
+                        // only the faces this tile owns
+                        const Box& nbx = mfi.nodaltilebox(d);
+                        const Array4<Real> sflux_arr = sflux[lev][d].array(mfi);
+
+                        AMREX_PARALLEL_FOR_3D(nbx, i, j, k, {
+                            sflux_arr(i,j,k,RhoH) = flux_arr(i,j,k,0);
+                        });
+                    }
+                }
+
+                const Array4<const Real> sold_arr = stateold[lev].array(mfi);
+                const Array4<Real> snew_arr = statenew[lev].array(mfi);
+                const Array4<const Real> fluxx = flux[0].const_array();
+                const Array4<const Real> fluxy = flux[1].const_array();
+#if (AMREX_SPACEDIM == 3)
+                const Array4<const Real> fluxz = flux[2].const_array();
+#else
+                const Array4<const Real> fluxz;
+#endif
+                const Array4<const Real> force_arr = force[lev].array(mfi);
+                const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+
+                AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
+                    UpdateRhoHCell(i, j, k, 0, sold_arr, snew_arr,
+                                   fluxx, fluxy, fluxz, force_arr, p0_arr, dx, dt_loc);
+                });
+            } // end MFIter loop
+        } // end omp parallel region
+
+        // increment or decrement the flux registers by area and time-weighted
+        // fluxes, as in MakeRhoHFlux
+        if (write_sflux) {
+
+            // Get the grid size
+            const Real* dxr = geom[lev].CellSize();
+            // NOTE: areas are different in DIM=2 and DIM=3
+#if (AMREX_SPACEDIM == 3)
+            const Real area[3] = {dxr[1]*dxr[2], dxr[0]*dxr[2], dxr[0]*dxr[1]};
+#else
+            const Real area[2] = {dxr[1], dxr[0]};
+#endif
+
+            if (flux_reg_s[lev+1]) {
+                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                    // update the lev+1/lev flux register (index lev+1)
+                    flux_reg_s[lev+1]->CrseInit(sflux[lev][i],i,RhoH,RhoH,1, -1.0*dt*area[i]);
+                }
+            }
+            if (flux_reg_s[lev]) {
+                for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+                    // update the lev/lev-1 flux register (index lev)
+                    flux_reg_s[lev]->FineAdd(sflux[lev][i],i,RhoH,RhoH,1, 1.0*dt*area[i]);
+                }
+            }
+        }
+    } // end loop over levels
+
+    SyncScal(statenew, RhoH, 1);
+}
+
+void
+Maestro::MakeRhoXFlux (const Vector<MultiFab>& state,
+                       Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sflux,
+                       Vector<MultiFab>& etarhoflux,
+                       Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& w0mac,
+                       const BaseState<Real>& rho0_old_in,
+                       const BaseState<Real>& rho0_edge_old_state,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_old,
+                       const BaseState<Real>& rho0_new_in,
+                       const BaseState<Real>& rho0_edge_new_state,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_new,
+                       const BaseState<Real>& rho0_predicted_edge_state,
+                       int start_comp, int num_comp)
+{
+    (this->*make_rhoX_flux)(state, sflux, etarhoflux, sedge, umac, w0mac,
+                            rho0_old_in, rho0_edge_old_state, r0mac_old,
+                            rho0_new_in, rho0_edge_new_state, r0mac_new,
+                            rho0_predicted_edge_state, start_comp, num_comp);
+}
+
+void
+Maestro::MakeRhoHFlux (const Vector<MultiFab>& state,
+                       Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sflux,
+                       Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& umac,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& w0mac,
+                       const BaseState<Real>& rho0_old_in,
+                       const BaseState<Real>& rho0_edge_old,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_old,
+                       const BaseState<Real>& rho0_new_in,
+                       const BaseState<Real>& rho0_edge_new,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& r0mac_new,
+                       const BaseState<Real>& rhoh0_old_in,
+                       const BaseState<Real>& rhoh0_edge_old,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& rh0mac_old,
+                       const BaseState<Real>& rhoh0_new_in,
+                       const BaseState<Real>& rhoh0_edge_new,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& rh0mac_new,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& h0mac_old,
+                       const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& h0mac_new)
+{
+    (this->*make_rhoH_flux)(state, sflux, sedge, umac, w0mac,
+                            rho0_old_in, rho0_edge_old, r0mac_old,
+                            rho0_new_in, rho0_edge_new, r0mac_new,
+                            rhoh0_old_in, rhoh0_edge_old, rh0mac_old,
+                            rhoh0_new_in, rhoh0_edge_new, rh0mac_new,
+                            h0mac_old, h0mac_new);
+}
+
+namespace {
+
+    // the MakeRhoHFluxT instance for species_pred_type spt.  The flux
+    // only depends on which quantity the enthalpy edge state is, so the
+    // T-predicting enthalpy_pred_types share the instance of the type
+    // they convert to.
+    template <int spt>
+    Maestro::RhoHFluxKernel
+    SelectRhoHFluxKernel (const int ept)
+    {
+        if (ept == pred_rhoh) {
+            return &Maestro::MakeRhoHFluxT<spt, pred_rhoh>;
+        } else if (ept == pred_rhohprime || ept == pred_T_then_rhohprime) {
+            return &Maestro::MakeRhoHFluxT<spt, pred_rhohprime>;
+        } else if (ept == pred_h || ept == pred_T_then_h || ept == pred_Tprime_then_h) {
+            return &Maestro::MakeRhoHFluxT<spt, pred_h>;
+        } else if (ept == pred_hprime) {
+            return &Maestro::MakeRhoHFluxT<spt, pred_hprime>;
+        }
+        Abort("SelectFluxKernels: invalid enthalpy_pred_type");
+        return nullptr;
+    }
+}
+
+void
+Maestro::SelectFluxKernels ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SelectFluxKernels()", SelectFluxKernels);
+
+    if (species_pred_type == pred_rhoprime_and_X) {
+        make_rhoX_flux = &Maestro::MakeRhoXFluxT<pred_rhoprime_and_X>;
+        make_rhoH_flux = SelectRhoHFluxKernel<pred_rhoprime_and_X>(enthalpy_pred_type);
+    } else if (species_pred_type == pred_rhoX) {
+        make_rhoX_flux = &Maestro::MakeRhoXFluxT<pred_rhoX>;
+        make_rhoH_flux = SelectRhoHFluxKernel<pred_rhoX>(enthalpy_pred_type);
+    } else if (species_pred_type == pred_rho_and_X) {
+        make_rhoX_flux = &Maestro::MakeRhoXFluxT<pred_rho_and_X>;
+        make_rhoH_flux = SelectRhoHFluxKernel<pred_rho_and_X>(enthalpy_pred_type);
+    } else {
+        Abort("SelectFluxKernels: invalid species_pred_type");
+    }
+}
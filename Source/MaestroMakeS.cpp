@@ -100,6 +100,8 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
 
     for (int lev=0; lev<=finest_level; ++lev) {
 
+        MultiFab* eos_cache_mf = EOSCacheMF(lev, scal[lev]);
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -108,6 +110,8 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
 
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
+            const Array4<Real> eos_cache_arr = eos_cache_mf ?
+                eos_cache_mf->array(mfi) : Array4<Real>();
 
             const Array4<Real> S_cc_arr = S_cc[lev].array(mfi);
             const Array4<Real> delta_gamma1_term_arr = delta_gamma1_term[lev].array(mfi);
@@ -136,7 +140,7 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
                     }
 
                     // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(eos_cache_arr, i, j, k, eos_state);
 
                     auto eos_xderivs = composition_derivatives(eos_state);
 
@@ -190,7 +194,7 @@ Maestro::Make_S_cc (Vector<MultiFab>& S_cc,
                     }
 
                     // dens, temp, and xmass are inputs
-                    eos(eos_input_rt, eos_state);
+                    eos_rt_cached(eos_cache_arr, i, j, k, eos_state);
 
                     auto eos_xderivs = composition_derivatives(eos_state);
 
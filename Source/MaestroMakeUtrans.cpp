@@ -4,11 +4,12 @@
 
 using namespace amrex;
 
+template <int ppm>
 void
-Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
-                     const Vector<MultiFab>& ufull,
-                     Vector<std::array< MultiFab, AMREX_SPACEDIM > >& utrans,
-                     const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& w0mac)
+Maestro::MakeUtransT (const Vector<MultiFab>& utilde,
+                      const Vector<MultiFab>& ufull,
+                      Vector<std::array< MultiFab, AMREX_SPACEDIM > >& utrans,
+                      const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& w0mac)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::MakeUtrans()", MakeUtrans);
@@ -23,7 +24,10 @@ Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
 
         const auto domlo = domainBox.loVect3d();
         const auto domhi = domainBox.hiVect3d();
-        const int ppm_type_local = ppm_type;
+
+        // ppm_type is a template parameter, so the tests of it here and
+        // in the kernels below are resolved at compile time
+        constexpr int ppm_type_local = ppm;
         const auto rel_eps_local = rel_eps;
         
         // get references to the MultiFabs at level lev
@@ -33,7 +37,7 @@ Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
 
         MultiFab u_mf, v_mf, w_mf;
 
-        if (ppm_type == 0) {
+        if (ppm_type_local == 0) {
             u_mf.define(grids[lev],dmap[lev],1,utilde[lev].nGrow());
             v_mf.define(grids[lev],dmap[lev],1,utilde[lev].nGrow());
 
@@ -45,7 +49,7 @@ Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
             MultiFab::Copy(w_mf, utilde[lev], 2, 0, 1, utilde[lev].nGrow());
 #endif
 
-        } else if (ppm_type == 1 || ppm_type == 2) {
+        } else if (ppm_type_local == 1 || ppm_type_local == 2) {
 
             u_mf.define(grids[lev],dmap[lev],1,ufull[lev].nGrow());
             v_mf.define(grids[lev],dmap[lev],1,ufull[lev].nGrow());
@@ -76,7 +80,7 @@ Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
             Array4<Real> const Im_arr = Im.array(mfi);
             Array4<Real> const Ip_arr = Ip.array(mfi);
 
-            if (ppm_type == 0) {
+            if (ppm_type_local == 0) {
                 // we're going to reuse Ip here as slopex as it has the
                 // correct number of ghost zones
                 // x-direction
@@ -182,7 +186,7 @@ Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
             Array4<Real> const Ip_arr = Ip.array(mfi);
             Array4<const Real> const w0_arr = w0_cart[lev].array(mfi);
 
-            if (ppm_type == 0) {
+            if (ppm_type_local == 0) {
                 // we're going to reuse Ip here as slopey as it has the
                 // correct number of ghost zones
                 Slopey(obx, v_mf.array(mfi), 
@@ -293,7 +297,7 @@ Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
             Array4<const Real> const w0macx = w0mac[lev][0].array(mfi);
 
             // x-direction
-            if (ppm_type == 0) {
+            if (ppm_type_local == 0) {
                 // we're going to reuse Ip here as slopex as it has the
                 // correct number of ghost zones
                 Slopex(obx, u_mf.array(mfi), 
@@ -407,7 +411,7 @@ Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
             Array4<const Real> const w0macy = w0mac[lev][1].array(mfi);
 
             // y-direction
-            if (ppm_type == 0) {
+            if (ppm_type_local == 0) {
                 // we're going to reuse Ip here as slopey as it has the
                 // correct number of ghost zones
                 Slopey(obx, v_mf.array(mfi), 
@@ -523,7 +527,7 @@ Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
             Array4<const Real> const w0macz = w0mac[lev][2].array(mfi);
 
             // z-direction
-            if (ppm_type == 0) {
+            if (ppm_type_local == 0) {
                 // we're going to reuse Ip here as slopez as it has the
                 // correct number of ghost zones
                 Slopez(obx, w_mf.array(mfi), 
@@ -640,3 +644,29 @@ Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
         FillPatchUedge(utrans);
     }
 }
+
+void
+Maestro::MakeUtrans (const Vector<MultiFab>& utilde,
+                     const Vector<MultiFab>& ufull,
+                     Vector<std::array< MultiFab, AMREX_SPACEDIM > >& utrans,
+                     const Vector<std::array< MultiFab, AMREX_SPACEDIM > >& w0mac)
+{
+    (this->*make_utrans)(utilde, ufull, utrans, w0mac);
+}
+
+void
+Maestro::SelectUtransKernel ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SelectUtransKernel()", SelectUtransKernel);
+
+    // the kernels only distinguish slopes from PPM, so ppm_type 2 shares
+    // the instance for 1
+    if (ppm_type == 0) {
+        make_utrans = &Maestro::MakeUtransT<0>;
+    } else if (ppm_type == 1 || ppm_type == 2) {
+        make_utrans = &Maestro::MakeUtransT<1>;
+    } else {
+        Abort("SelectUtransKernel: invalid ppm_type");
+    }
+}
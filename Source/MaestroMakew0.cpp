@@ -343,9 +343,9 @@ Maestro::Makew0PlanarVarg(const BaseState<Real>& w0_old,
     auto grav_edge_fine_arr = grav_edge_fine.array();
 
     // create time-centered base-state quantities
-    p0_nph_fine.copy(0.5*(p0_old_fine+ p0_new_fine));
-    rho0_nph_fine.copy(0.5*(rho0_old_fine + rho0_new_fine));
-    gamma1bar_nph_fine.copy(0.5*(gamma1bar_old_fine + gamma1bar_new_fine));
+    p0_nph_fine.lincomb(0.5, p0_old_fine, 0.5, p0_new_fine);
+    rho0_nph_fine.lincomb(0.5, rho0_old_fine, 0.5, rho0_new_fine);
+    gamma1bar_nph_fine.lincomb(0.5, gamma1bar_old_fine, 0.5, gamma1bar_new_fine);
 
     // 3) solve to w0bar -- here we just take into account the Sbar and
     //    volume discrepancy terms
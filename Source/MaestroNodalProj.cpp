@@ -152,37 +152,7 @@ Maestro::NodalProj (int proj_type,
  */
     SetBoundaryVelocity(Vproj);
 
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-    {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        } else {
-            if (phys_bc[idim] == Outflow) {
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            }
-
-            if (phys_bc[AMREX_SPACEDIM+idim] == Outflow) {
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            }
-        }
-    }
-
-    LPInfo info;
-    info.setAgglomeration(true);
-    info.setConsolidation(true);
-    info.setMetricTerm(false);
-
-    MLNodeLaplacian mlndlap(geom, grids, dmap, info);
-    mlndlap.setGaussSeidel(true);
-    mlndlap.setHarmonicAverage(false);
-
-    mlndlap.setDomainBC(mlmg_lobc, mlmg_hibc);
+    MLNodeLaplacian& mlndlap = NodalLinOp();
 
     // set sig in the MLNodeLaplacian object
     for (int ilev = 0; ilev <= finest_level; ++ilev) {
@@ -205,6 +175,17 @@ Maestro::NodalProj (int proj_type,
         phi[lev].setVal(0.);
     }
 
+    // a regular time step solves for phi = dt*pi^{n+1/2}, so dt times the
+    // previous step's pi is a close initial guess
+    const bool warm_start = warm_start_projections &&
+        proj_type == regular_timestep_comp;
+    if (warm_start) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Copy(phi[lev], pi[lev], 0, 0, 1, 0);
+            phi[lev].mult(dt, 0, 1, 0);
+        }
+    }
+
     // multiply rhcc = beta0*(S-Sbar) by -1 since we want
     // rhstotal to contain div(beta*Vproj) - beta0*(S-Sbar)
     for (int lev=0; lev<=finest_level; ++lev) {
@@ -299,6 +280,11 @@ Maestro::NodalProj (int proj_type,
 #endif
     Print() << "Done calling nodal solver" << std::endl;
 
+    if (maestro_verbose > 0) {
+        Print() << "Nodal projection: " << mlmg.getNumIters() << " V-cycles"
+                << (warm_start ? " (warm start)" : "") << std::endl;
+    }
+
     // convert beta0*Vproj back to Vproj
     for (int lev=0; lev<=finest_level; ++lev) {
         for (int dir=0; dir<AMREX_SPACEDIM; ++dir) {
@@ -668,3 +654,48 @@ void Maestro::MakePiCC(const Vector<MultiFab>& beta0_cart)
         }
     }
 }
+
+MLNodeLaplacian&
+Maestro::NodalLinOp ()
+{
+    CheckLinOps();
+
+    if (!nodal_linop) {
+        // timer for profiling
+        BL_PROFILE_VAR("Maestro::NodalLinOp()", NodalLinOp);
+
+        std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
+        std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        {
+            if (Geom(0).isPeriodic(idim)) {
+                mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
+            } else {
+                if (phys_bc[idim] == Outflow) {
+                    mlmg_lobc[idim] = LinOpBCType::Dirichlet;
+                } else {
+                    mlmg_lobc[idim] = LinOpBCType::Neumann;
+                }
+
+                if (phys_bc[AMREX_SPACEDIM+idim] == Outflow) {
+                    mlmg_hibc[idim] = LinOpBCType::Dirichlet;
+                } else {
+                    mlmg_hibc[idim] = LinOpBCType::Neumann;
+                }
+            }
+        }
+
+        LPInfo info;
+        info.setAgglomeration(true);
+        info.setConsolidation(true);
+        info.setMetricTerm(false);
+
+        nodal_linop.reset(new MLNodeLaplacian(geom, grids, dmap, info));
+        nodal_linop->setGaussSeidel(true);
+        nodal_linop->setHarmonicAverage(false);
+
+        nodal_linop->setDomainBC(mlmg_lobc, mlmg_hibc);
+    }
+
+    return *nodal_linop;
+}
@@ -4,43 +4,423 @@
 
 using namespace amrex;
 
+namespace
+{
+    // constant used in Colella 2008
+    constexpr Real ppm_C = 1.25;
+
+    // a(i,j,k,n) shifted by o cells in direction dir
+    template <int dir>
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    Real at (Array4<const Real> const& a, int i, int j, int k, int o, int n)
+    {
+        return dir == 0 ? a(i+o,j,k,n) : (dir == 1 ? a(i,j+o,k,n) : a(i,j,k+o,n));
+    }
+
+    // limited van Leer slope in a cell, given the cell and its neighbors
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    Real ppm_vanleer (const Real sm1, const Real s0, const Real sp1)
+    {
+        Real dsvl = 0.0;
+        Real dsc = 0.5 * (sp1 - sm1);
+        Real dsl = 2.0 * (s0 - sm1);
+        Real dsr = 2.0 * (sp1 - s0);
+        if (dsl*dsr > 0.0) 
+            dsvl = copysign(1.0,dsc)*min(fabs(dsc),min(fabs(dsl),fabs(dsr)));
+        return dsvl;
+    }
+
+    // ppm_type = 1 value on the face between cells f-1 and f, given
+    // s(f-2) ... s(f+1)
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    Real ppm1_face (const Real sm2, const Real sm1, const Real s0, const Real sp1)
+    {
+        Real sedge = 0.5*(s0+sm1) - (ppm_vanleer(sm1,s0,sp1)-ppm_vanleer(sm2,sm1,s0))/6.0;
+
+        // Make sure sedge lies in between adjacent cell-centered values.
+        sedge = max(sedge,min(s0,sm1));
+        sedge = min(sedge,max(s0,sm1));
+        return sedge;
+    }
+
+    // ppm_type = 2 (limited fourth order) value on the face between
+    // cells f-1 and f, given s(f-2) ... s(f+1)
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    Real ppm2_face (const Real sm2, const Real sm1, const Real s0, const Real sp1)
+    {
+        Real sedge = (7.0/12.0)*(sm1+s0) - (1.0/12.0)*(sm2+sp1);
+
+        // Limit sedge.
+        if ((sedge-sm1)*(s0-sedge) < 0.0) {
+            Real D2  = 3.0*(sm1-2.0*sedge+s0);
+            Real D2L = sm2-2.0*sm1+s0;
+            Real D2R = sm1-2.0*s0+sp1;
+            Real sgn = copysign(1.0,D2);
+            Real D2LIM = sgn*max(min(ppm_C*sgn*D2L,min(ppm_C*sgn*D2R,sgn*D2)),0.0);
+            sedge = 0.5*(sm1+s0) - D2LIM/6.0;
+        }
+        return sedge;
+    }
+
+    // the modified stencil for the first interior face next to a low
+    // EXT_DIR/HOEXTRAP boundary, given s(f-2) (the ghost cell) ... s(f+1)
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    Real ppm_face_bclo (const Real sm2, const Real sm1, const Real s0, const Real sp1)
+    {
+        Real sedge = -0.2 *sm2 
+            + 0.75*sm1 
+            + 0.5 *s0 
+            - 0.05*sp1;
+
+        // Make sure sedge lies in between adjacent cell-centered values.
+        sedge = max(sedge,min(s0,sm1));
+        sedge = min(sedge,max(s0,sm1));
+        return sedge;
+    }
+
+    // the same next to a high boundary, given s(f-2) ... s(f+1) (the
+    // ghost cell)
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    Real ppm_face_bchi (const Real sm2, const Real sm1, const Real s0, const Real sp1)
+    {
+        Real sedge = -0.2 *sp1 
+            + 0.75*s0 
+            + 0.5 *sm1 
+            - 0.05*sm2;
+
+        // Make sure sedge lies in between adjacent cell-centered values.
+        sedge = max(sedge,min(sm1,s0));
+        sedge = min(sedge,max(sm1,s0));
+        return sedge;
+    }
+
+    // ppm_type = 1 quadratic limiter on the cell's sm and sp
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    void ppm1_limit (const Real s0, Real& sm, Real& sp)
+    {
+        if ((sp-s0)*(s0-sm) <= 0.0) {
+            sp = s0;
+            sm = s0;
+        } else if (fabs(sp-s0) >= 2.0*fabs(sm-s0)) {
+            sp = 3.0*s0 - 2.0*sm;
+        } else if (fabs(sm-s0) >= 2.0*fabs(sp-s0)) {
+            sm = 3.0*s0 - 2.0*sp;
+        }
+    }
+
+    // ppm_type = 2 (Colella 2008) limiter giving the cell's sm and sp
+    // from the faces f-1 ... f+2 and s(i-2) ... s(i+2)
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    void ppm2_limit (const Real sedgel, const Real sedge,
+                     const Real sedger, const Real sedgerr,
+                     const Real sm2, const Real sm1, const Real s0,
+                     const Real sp1, const Real sp2,
+                     Real& sm, Real& sp)
+    {
+        Real alphap = sedger-s0;
+        Real alpham = sedge-s0;
+        bool bigp = fabs(alphap) > 2.0*fabs(alpham);
+        bool bigm = fabs(alpham) > 2.0*fabs(alphap);
+        bool extremum = false;
+
+        if (alpham*alphap >= 0.0) {
+            extremum = true;
+        } else if (bigp || bigm) {
+            // Possible extremum. We look at cell centered values and face
+            // centered values for a change in sign in the differences adjacent to
+            // the cell. We use the pair of differences whose minimum magnitude is the
+            // largest, and thus least susceptible to sensitivity to roundoff.
+            Real dafacem = sedge - sedgel;
+            Real dafacep = sedgerr - sedger;
+            Real dabarm = s0 - sm1;
+            Real dabarp = sp1 - s0;
+            Real dafacemin = min(fabs(dafacem),fabs(dafacep));
+            Real dabarmin = min(fabs(dabarm),fabs(dabarp));
+            Real dachkm = 0.0;
+            Real dachkp = 0.0;
+
+            if (dafacemin >= dabarmin) {
+                dachkm = dafacem;
+                dachkp = dafacep;
+            } else {
+                dachkm = dabarm;
+                dachkp = dabarp;
+            }
+            extremum = (dachkm*dachkp <= 0.0);
+        }
+
+        if (extremum) {
+            Real D2  = 6.0*(alpham + alphap);
+            Real D2L = sm2-2.0*sm1+s0;
+            Real D2R = s0-2.0*sp1+sp2;
+            Real D2C = sm1-2.0*s0+sp1;
+            Real sgn = copysign(1.0,D2);
+            Real D2LIM = max(min(sgn*D2,min(ppm_C*sgn*D2L,min(ppm_C*sgn*D2R,ppm_C*sgn*D2C))),0.0);
+            Real D2ABS = max(fabs(D2),1.e-10);
+            alpham = alpham*D2LIM/D2ABS;
+            alphap = alphap*D2LIM/D2ABS;
+        } else {
+            if (bigp) {
+                Real sgn = copysign(1.0,alpham);
+                Real amax = -alphap*alphap / (4.0*(alpham + alphap));
+                Real delam = sm1 - s0;
+                if (sgn*amax >= sgn*delam) {
+                    if (sgn*(delam - alpham) >= 1.e-10) {
+                        alphap = -2.0*delam - 2.0*sgn*sqrt(delam*delam - delam*alpham);
+                    } else {
+                        alphap = -2.0*alpham;
+                    }
+                }
+            }
+            if (bigm) {
+                Real sgn = copysign(1.0,alphap);
+                Real amax = -alpham*alpham / (4.0*(alpham + alphap));
+                Real delap = sp1 - s0;
+                if (sgn*amax >= sgn*delap) {
+                    if (sgn*(delap - alphap) >= 1.e-10) {
+                        alpham = -2.0*delap - 2.0*sgn*sqrt(delap*delap - delap*alphap);
+                    } else {
+                        alpham = -2.0*alphap;
+                    }
+                }
+            }
+        }
+
+        sm = s0 + alpham;
+        sp = s0 + alphap;
+    }
+
+    // trace under the parabola given by sm, sp to get Ip and Im
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    void ppm_trace (const Real s0, const Real sm, const Real sp,
+                    const Real ul, const Real ur,
+                    const Real dt, const Real dx, const Real rel_eps,
+                    Real& Ip, Real& Im)
+    {
+        Real s6 = 6.0*s0 - 3.0*(sm+sp);
+
+        Real sigma = fabs(ur)*dt/dx;
+        if (ur > rel_eps) {
+            Ip = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
+        } else {
+            Ip = s0;
+        }
+
+        sigma = fabs(ul)*dt/dx;
+        if (ul < -rel_eps) {
+            Im = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
+        } else {
+            Im = s0;
+        }
+    }
+
+    // Direction dir of Maestro::PPM, computing each face value once.
+    // The faces of bx go into a buffer, then every cell of bx is traced
+    // from its faces with no boundary tests, and finally the cells next
+    // to an EXT_DIR/HOEXTRAP boundary (two for ppm_type = 1, three for
+    // ppm_type = 2) are redone with the boundary stencils.  This gives
+    // the same result as the cell by cell kernels in Maestro::PPM as
+    // long as the domain is wide enough that the low and high boundary
+    // cells are distinct.  ppm is ppm_type, 1 or 2.
+    template <int dir, int ppm>
+    void PPMEdgeOnce (const Box& bx,
+                      Array4<const Real> const s,
+                      Array4<const Real> const u,
+                      Array4<Real> const Ip,
+                      Array4<Real> const Im,
+                      const int domlo, const int domhi,
+                      const int bclo, const int bchi,
+                      const Real dt, const Real dx, const Real rel_eps,
+                      const bool is_umac,
+                      const int comp, const int ncomp, const int icomp)
+    {
+        // the faces of bx, plus one more on each side for ppm_type = 2
+        Box fbx = amrex::surroundingNodes(bx, dir);
+        if (ppm == 2) {
+            fbx.grow(dir, 1);
+        }
+
+        FArrayBox faces(fbx, ncomp);
+        Elixir e_faces = faces.elixir();
+        const Array4<Real> sedge = faces.array();
+
+        AMREX_PARALLEL_FOR_4D(fbx, ncomp, i, j, k, nc,
+        {
+            const int n = comp + nc;
+            const Real sm2 = at<dir>(s,i,j,k,-2,n);
+            const Real sm1 = at<dir>(s,i,j,k,-1,n);
+            const Real s0  = s(i,j,k,n);
+            const Real sp1 = at<dir>(s,i,j,k, 1,n);
+
+            sedge(i,j,k,nc) = ppm == 1 ? ppm1_face(sm2, sm1, s0, sp1)
+                                            : ppm2_face(sm2, sm1, s0, sp1);
+        });
+
+        const Array4<const Real> sedge_c = faces.const_array();
+
+        // interior kernel
+        AMREX_PARALLEL_FOR_4D(bx, ncomp, i, j, k, nc,
+        {
+            const int n = comp + nc;
+            const Real s0 = s(i,j,k,n);
+
+            Real sm = sedge_c(i,j,k,nc);
+            Real sp = at<dir>(sedge_c,i,j,k,1,nc);
+
+            if (ppm == 1) {
+                ppm1_limit(s0, sm, sp);
+            } else {
+                ppm2_limit(at<dir>(sedge_c,i,j,k,-1,nc), sm, sp, at<dir>(sedge_c,i,j,k,2,nc),
+                           at<dir>(s,i,j,k,-2,n), at<dir>(s,i,j,k,-1,n), s0,
+                           at<dir>(s,i,j,k,1,n), at<dir>(s,i,j,k,2,n),
+                           sm, sp);
+            }
+
+            const Real ul = u(i,j,k);
+            const Real ur = is_umac ? at<dir>(u,i,j,k,1,0) : ul;
+
+            ppm_trace(s0, sm, sp, ul, ur, dt, dx, rel_eps,
+                      Ip(i,j,k,icomp+nc), Im(i,j,k,icomp+nc));
+        });
+
+        // boundary kernels
+        const int nbc = ppm == 1 ? 2 : 3;
+
+        for (int side = 0; side < 2; ++side) {
+
+            const int bc = side == 0 ? bclo : bchi;
+            if (bc != EXT_DIR && bc != HOEXTRAP) {
+                continue;
+            }
+
+            Box slab = bx;
+            if (side == 0) {
+                slab.setSmall(dir, amrex::max(bx.smallEnd(dir), domlo));
+                slab.setBig(dir, amrex::min(bx.bigEnd(dir), domlo+nbc-1));
+            } else {
+                slab.setSmall(dir, amrex::max(bx.smallEnd(dir), domhi-nbc+1));
+                slab.setBig(dir, amrex::min(bx.bigEnd(dir), domhi));
+            }
+            if (!slab.ok()) {
+                continue;
+            }
+
+            AMREX_PARALLEL_FOR_4D(slab, ncomp, i, j, k, nc,
+            {
+                const int n = comp + nc;
+                const int p = dir == 0 ? i : (dir == 1 ? j : k);
+
+                const Real sm3 = at<dir>(s,i,j,k,-3,n);
+                const Real sm2 = at<dir>(s,i,j,k,-2,n);
+                const Real sm1 = at<dir>(s,i,j,k,-1,n);
+                const Real s0  = s(i,j,k,n);
+                const Real sp1 = at<dir>(s,i,j,k, 1,n);
+                const Real sp2 = at<dir>(s,i,j,k, 2,n);
+                const Real sp3 = at<dir>(s,i,j,k, 3,n);
+
+                Real sm = 0.0;
+                Real sp = 0.0;
+
+                if (side == 0 && p == domlo) {
+                    // The value in the first cc ghost cell represents the edge value.
+                    sm = sm1;
+                    sp = ppm_face_bclo(sm1, s0, sp1, sp2);
+                } else if (side == 1 && p == domhi) {
+                    // The value in the first cc ghost cell represents the edge value.
+                    sp = sp1;
+                    sm = ppm_face_bchi(sm2, sm1, s0, sp1);
+                } else if (ppm == 1) {
+                    if (side == 0) {
+                        sm = ppm_face_bclo(sm2, sm1, s0, sp1);
+                        sp = at<dir>(sedge_c,i,j,k,1,nc);
+                    } else {
+                        sm = sedge_c(i,j,k,nc);
+                        sp = ppm_face_bchi(sm1, s0, sp1, sp2);
+                    }
+                    ppm1_limit(s0, sm, sp);
+                } else {
+                    Real sedgel  = at<dir>(sedge_c,i,j,k,-1,nc);
+                    Real sedge   = sedge_c(i,j,k,nc);
+                    Real sedger  = at<dir>(sedge_c,i,j,k, 1,nc);
+                    Real sedgerr = at<dir>(sedge_c,i,j,k, 2,nc);
+
+                    if (p == domlo+1) {
+                        sedgel = sm2;
+                        sedge = ppm_face_bclo(sm2, sm1, s0, sp1);
+                    } else if (p == domlo+2) {
+                        sedgel = ppm_face_bclo(sm3, sm2, sm1, s0);
+                    } else if (p == domhi-1) {
+                        sedger = ppm_face_bchi(sm1, s0, sp1, sp2);
+                    } else if (p == domhi-2) {
+                        sedgerr = ppm_face_bchi(s0, sp1, sp2, sp3);
+                    }
+
+                    ppm2_limit(sedgel, sedge, sedger, sedgerr,
+                               sm2, sm1, s0, sp1, sp2, sm, sp);
+                }
+
+                const Real ul = u(i,j,k);
+                const Real ur = is_umac ? at<dir>(u,i,j,k,1,0) : ul;
+
+                ppm_trace(s0, sm, sp, ul, ur, dt, dx, rel_eps,
+                          Ip(i,j,k,icomp+nc), Im(i,j,k,icomp+nc));
+            });
+        }
+    }
+}
+
+template <int ppm>
 void
-Maestro::PPM (const Box& bx, 
-              Array4<const Real> const s,
-              Array4<const Real> const u,
-              Array4<const Real> const v,
+Maestro::PPMT (const Box& bx, 
+               Array4<const Real> const s,
+               Array4<const Real> const u,
+               Array4<const Real> const v,
 #if (AMREX_SPACEDIM == 3)
-              Array4<const Real> const w,
+               Array4<const Real> const w,
 #endif
-              Array4<Real> const Ip,
-              Array4<Real> const Im,
-              const Box& domainBox,
-              const Vector<BCRec>& bcs,
-              const amrex::GpuArray<Real,AMREX_SPACEDIM> dx,
-              const bool is_umac, const int comp, const int bccomp)
+               Array4<Real> const Ip,
+               Array4<Real> const Im,
+               const Box& domainBox,
+               const Vector<BCRec>& bcs,
+               const amrex::GpuArray<Real,AMREX_SPACEDIM> dx,
+               const bool is_umac, const int comp, const int bccomp,
+               const int ncomp)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::PPM()", PPM);
 
     // constant used in Colella 2008
     const Real C = 1.25;
-    const auto n = comp;
     const auto dt_local = dt;
     const auto rel_eps_local = rel_eps;
 
+    // ppm_type is a template parameter, so the choice of kernel below is
+    // made at compile time
+    constexpr int ppm_type_loc = ppm;
+
     const auto domlo = domainBox.loVect3d();
     const auto domhi = domainBox.hiVect3d();
 
+    // the edge-once engine needs the low and high boundary cells to be
+    // distinct; narrower directions use the kernels below
+    const bool edge_once = ppm_edge_once && (ppm_type_loc == 1 || ppm_type_loc == 2);
+
     /////////////
     // x-dir
     /////////////
     int bclo = bcs[bccomp].lo()[0];
     int bchi = bcs[bccomp].hi()[0];
 
-    if (ppm_type == 1) {
+    if (edge_once && domhi[0]-domlo[0] >= 5) {
+        PPMEdgeOnce<0,ppm>(bx, s, u, Ip, Im, domlo[0], domhi[0], bclo, bchi,
+                        dt_local, dx[0], rel_eps_local, is_umac,
+                        comp, ncomp, 0);
+    } else if (ppm_type_loc == 1) {
 
-        AMREX_PARALLEL_FOR_3D(bx, i, j, k, 
+        AMREX_PARALLEL_FOR_4D(bx, ncomp, i, j, k, nc,
         {
+            const int n = comp + nc;
+
             // Compute van Leer slopes in x-direction 
 
             // sm
@@ -207,40 +587,42 @@ Maestro::PPM (const Box& bx,
                 // u is MAC velocity -- use edge-based indexing
                 Real sigma = fabs(u(i+1,j,k)) * dt_local / dx[0];
                 if (u(i+1,j,k) > rel_eps_local) {
-                    Ip(i,j,k,0) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
+                    Ip(i,j,k,nc) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,0) = s(i,j,k,n);
+                    Ip(i,j,k,nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(u(i,j,k)) * dt_local / dx[0];
                 if (u(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,0) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
+                    Im(i,j,k,nc) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,0) = s(i,j,k,n);
+                    Im(i,j,k,nc) = s(i,j,k,n);
                }
 
             } else {
 
                 Real sigma = fabs(u(i,j,k))*dt_local/dx[0];
                 if (u(i,j,k) > rel_eps_local) {
-                    Ip(i,j,k,0) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
+                    Ip(i,j,k,nc) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,0) = s(i,j,k,n);
+                    Ip(i,j,k,nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(u(i,j,k))*dt_local/dx[0];
                 if (u(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,0) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
+                    Im(i,j,k,nc) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,0) = s(i,j,k,n);
+                    Im(i,j,k,nc) = s(i,j,k,n);
                 }
             }
         });
 
-    } else if (ppm_type == 2) {
+    } else if (ppm_type_loc == 2) {
 
-        AMREX_PARALLEL_FOR_3D(bx, i, j, k, 
+        AMREX_PARALLEL_FOR_4D(bx, ncomp, i, j, k, nc,
         {
+            const int n = comp + nc;
+
             // -1
             // Interpolate s to x-edges.
             Real sedgel = (7.0/12.0)*(s(i-2,j,k,n)+s(i-1,j,k,n)) 
@@ -485,7 +867,7 @@ Maestro::PPM (const Box& bx,
                             Real amax = -alpham*alpham / (4.0*(alpham + alphap));
                             Real delap = s(i+1,j,k,n) - s(i,j,k,n);
                             if (sgn*amax >= sgn*delap) {
-                                if (sgn*(delap - alphap) >= 1.e10) {
+                                if (sgn*(delap - alphap) >= 1.e-10) {
                                     alpham = (-2.0*delap - 2.0*sgn*sqrt(delap*delap - delap*alphap));
                                 } else {
                                     alpham = -2.0*alphap;
@@ -626,34 +1008,34 @@ Maestro::PPM (const Box& bx,
                 Real sigma = fabs(u(i+1,j,k))*dt_local/dx[0];
                 
                 if (u(i+1,j,k) > rel_eps_local) {
-                    Ip(i,j,k,0) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
+                    Ip(i,j,k,nc) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,0) = s(i,j,k,n);
+                    Ip(i,j,k,nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(u(i,j,k))*dt_local/dx[0];
 
                 if (u(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,0) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
+                    Im(i,j,k,nc) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,0) = s(i,j,k,n);
+                    Im(i,j,k,nc) = s(i,j,k,n);
                 }
             } else {
 
                 Real sigma = fabs(u(i,j,k))*dt_local/dx[0];
 
                 if (u(i,j,k) > rel_eps_local) {
-                    Ip(i,j,k,0) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
+                    Ip(i,j,k,nc) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,0) = s(i,j,k,n);
+                    Ip(i,j,k,nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(u(i,j,k))*dt_local/dx[0];
 
                 if (u(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,0) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
+                    Im(i,j,k,nc) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,0) = s(i,j,k,n);
+                    Im(i,j,k,nc) = s(i,j,k,n);
                 }
             }
         });
@@ -665,10 +1047,16 @@ Maestro::PPM (const Box& bx,
     bclo = bcs[bccomp].lo()[1];
     bchi = bcs[bccomp].hi()[1];
 
-    if (ppm_type == 1) {
+    if (edge_once && domhi[1]-domlo[1] >= 5) {
+        PPMEdgeOnce<1,ppm>(bx, s, v, Ip, Im, domlo[1], domhi[1], bclo, bchi,
+                        dt_local, dx[1], rel_eps_local, is_umac,
+                        comp, ncomp, ncomp);
+    } else if (ppm_type_loc == 1) {
 
-        AMREX_PARALLEL_FOR_3D(bx, i, j, k, 
+        AMREX_PARALLEL_FOR_4D(bx, ncomp, i, j, k, nc,
         {
+            const int n = comp + nc;
+
             // Compute van Leer slopes in y-direction.
 
             // sm
@@ -835,40 +1223,42 @@ Maestro::PPM (const Box& bx,
                 // v is MAC velocity -- use edge-based indexing
                 Real sigma = fabs(v(i,j+1,k))*dt_local/dx[1];
                 if (v(i,j+1,k) > rel_eps_local) {
-                    Ip(i,j,k,1) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
+                    Ip(i,j,k,ncomp+nc) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,1) = s(i,j,k,n);
+                    Ip(i,j,k,ncomp+nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(v(i,j,k))*dt_local/dx[1];
                 if (v(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,1) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
+                    Im(i,j,k,ncomp+nc) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,1) = s(i,j,k,n);
+                    Im(i,j,k,ncomp+nc) = s(i,j,k,n);
                 }
 
             } else {
 
                 Real sigma = fabs(v(i,j,k))*dt_local/dx[1];
                 if (v(i,j,k) > rel_eps_local) {
-                    Ip(i,j,k,1) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
+                    Ip(i,j,k,ncomp+nc) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,1) = s(i,j,k,n);
+                    Ip(i,j,k,ncomp+nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(v(i,j,k))*dt_local/dx[1];
                 if (v(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,1) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
+                    Im(i,j,k,ncomp+nc) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,1) = s(i,j,k,n);
+                    Im(i,j,k,ncomp+nc) = s(i,j,k,n);
                 }
             }
         });
 
-    } else if (ppm_type == 2) {
+    } else if (ppm_type_loc == 2) {
 
-        AMREX_PARALLEL_FOR_3D(bx, i, j, k, 
+        AMREX_PARALLEL_FOR_4D(bx, ncomp, i, j, k, nc,
         {
+            const int n = comp + nc;
+
             // -1
             // Interpolate s to y-edges.
             Real sedgel = (7.0/12.0)*(s(i,j-2,k,n)+s(i,j-1,k,n)) 
@@ -1252,32 +1642,32 @@ Maestro::PPM (const Box& bx,
                 // v is MAC velocity -- use edge-based indexing
                 Real sigma = fabs(v(i,j+1,k))*dt_local/dx[1];
                 if (v(i,j+1,k) > rel_eps_local) {
-                    Ip(i,j,k,1) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
+                    Ip(i,j,k,ncomp+nc) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,1) = s(i,j,k,n);
+                    Ip(i,j,k,ncomp+nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(v(i,j,k))*dt_local/dx[1];
                 if (v(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,1) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
+                    Im(i,j,k,ncomp+nc) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,1) = s(i,j,k,n);
+                    Im(i,j,k,ncomp+nc) = s(i,j,k,n);
                 }
 
             } else {
 
                 Real sigma = fabs(v(i,j,k))*dt_local/dx[1];
                 if (v(i,j,k) > rel_eps_local) {
-                    Ip(i,j,k,1) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
+                    Ip(i,j,k,ncomp+nc) = sp - 0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,1) = s(i,j,k,n);
+                    Ip(i,j,k,ncomp+nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(v(i,j,k))*dt_local/dx[1];
                 if (v(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,1) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
+                    Im(i,j,k,ncomp+nc) = sm + 0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,1) = s(i,j,k,n);
+                    Im(i,j,k,ncomp+nc) = s(i,j,k,n);
                 }
             }
         });
@@ -1290,10 +1680,16 @@ Maestro::PPM (const Box& bx,
     bclo = bcs[bccomp].lo()[2];
     bchi = bcs[bccomp].hi()[2];
 
-    if (ppm_type == 1) {
+    if (edge_once && domhi[2]-domlo[2] >= 5) {
+        PPMEdgeOnce<2,ppm>(bx, s, w, Ip, Im, domlo[2], domhi[2], bclo, bchi,
+                        dt_local, dx[2], rel_eps_local, is_umac,
+                        comp, ncomp, 2*ncomp);
+    } else if (ppm_type_loc == 1) {
 
-        AMREX_PARALLEL_FOR_3D(bx, i, j, k, 
+        AMREX_PARALLEL_FOR_4D(bx, ncomp, i, j, k, nc,
         {
+            const int n = comp + nc;
+
             // Compute van Leer slopes in z-direction.
 
             // sm
@@ -1461,46 +1857,48 @@ Maestro::PPM (const Box& bx,
                 Real sigma = fabs(w(i,j,k+1))*dt_local/dx[2];
                 
                 if (w(i,j,k+1) > rel_eps_local) {
-                    Ip(i,j,k,2) = sp - 
+                    Ip(i,j,k,2*ncomp+nc) = sp - 
                         0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,2) = s(i,j,k,n);
+                    Ip(i,j,k,2*ncomp+nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(w(i,j,k))*dt_local/dx[2];
 
                 if (w(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,2) = sm + 
+                    Im(i,j,k,2*ncomp+nc) = sm + 
                         0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,2) = s(i,j,k,n);
+                    Im(i,j,k,2*ncomp+nc) = s(i,j,k,n);
                 }
             } else {
 
                 Real sigma = fabs(w(i,j,k))*dt_local/dx[2];
                 
                 if (w(i,j,k) > rel_eps_local) {
-                    Ip(i,j,k,2) = sp - 
+                    Ip(i,j,k,2*ncomp+nc) = sp - 
                         0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,2) = s(i,j,k,n);
+                    Ip(i,j,k,2*ncomp+nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(w(i,j,k))*dt_local/dx[2];
                 
                 if (w(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,2) = sm + 
+                    Im(i,j,k,2*ncomp+nc) = sm + 
                         0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,2) = s(i,j,k,n);
+                    Im(i,j,k,2*ncomp+nc) = s(i,j,k,n);
                 }
             }
         });
 
-    } else if (ppm_type == 2) {
+    } else if (ppm_type_loc == 2) {
 
-        AMREX_PARALLEL_FOR_3D(bx, i, j, k, 
+        AMREX_PARALLEL_FOR_4D(bx, ncomp, i, j, k, nc,
         {
+            const int n = comp + nc;
+
             // -1
             // Interpolate s to z-edges.
             Real sedgel = (7.0/12.0)*(s(i,j,k-2,n)+s(i,j,k-1,n)) 
@@ -1887,40 +2285,82 @@ Maestro::PPM (const Box& bx,
                 Real sigma = fabs(w(i,j,k+1))*dt_local/dx[2];
                 
                 if (w(i,j,k+1) > rel_eps_local) {
-                    Ip(i,j,k,2) = sp - 
+                    Ip(i,j,k,2*ncomp+nc) = sp - 
                         0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,2) = s(i,j,k,n);
+                    Ip(i,j,k,2*ncomp+nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(w(i,j,k))*dt_local/dx[2];
                 
                 if (w(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,2) = sm + 
+                    Im(i,j,k,2*ncomp+nc) = sm + 
                         0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,2) = s(i,j,k,n);
+                    Im(i,j,k,2*ncomp+nc) = s(i,j,k,n);
                 }
             } else {
                 Real sigma = fabs(w(i,j,k))*dt_local/dx[2];
                 
                 if (w(i,j,k) > rel_eps_local) {
-                    Ip(i,j,k,2) = sp - 
+                    Ip(i,j,k,2*ncomp+nc) = sp - 
                         0.5*sigma*(sp-sm-(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Ip(i,j,k,2) = s(i,j,k,n);
+                    Ip(i,j,k,2*ncomp+nc) = s(i,j,k,n);
                 }
 
                 sigma = fabs(w(i,j,k))*dt_local/dx[2];
                 
                 if (w(i,j,k) < -rel_eps_local) {
-                    Im(i,j,k,2) = sm + 
+                    Im(i,j,k,2*ncomp+nc) = sm + 
                         0.5*sigma*(sp-sm+(1.0-2.0/3.0*sigma)*s6);
                 } else {
-                    Im(i,j,k,2) = s(i,j,k,n);
+                    Im(i,j,k,2*ncomp+nc) = s(i,j,k,n);
                 }
             }
         });  
     }
 #endif
 }
+
+void
+Maestro::PPM (const Box& bx, 
+              Array4<const Real> const s,
+              Array4<const Real> const u,
+              Array4<const Real> const v,
+#if (AMREX_SPACEDIM == 3)
+              Array4<const Real> const w,
+#endif
+              Array4<Real> const Ip,
+              Array4<Real> const Im,
+              const Box& domainBox,
+              const Vector<BCRec>& bcs,
+              const amrex::GpuArray<Real,AMREX_SPACEDIM> dx,
+              const bool is_umac, const int comp, const int bccomp,
+              const int ncomp)
+{
+    (this->*ppm_kernel)(bx, s, u, v,
+#if (AMREX_SPACEDIM == 3)
+                        w,
+#endif
+                        Ip, Im, domainBox, bcs, dx, is_umac, comp, bccomp, ncomp);
+}
+
+void
+Maestro::SelectPPMKernel ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SelectPPMKernel()", SelectPPMKernel);
+
+    // with ppm_type = 0 the callers use slopes instead, and PPMT<0>, like
+    // PPM before it, does nothing
+    if (ppm_type == 0) {
+        ppm_kernel = &Maestro::PPMT<0>;
+    } else if (ppm_type == 1) {
+        ppm_kernel = &Maestro::PPMT<1>;
+    } else if (ppm_type == 2) {
+        ppm_kernel = &Maestro::PPMT<2>;
+    } else {
+        Abort("SelectPPMKernel: invalid ppm_type");
+    }
+}
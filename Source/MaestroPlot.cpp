@@ -1,8 +1,11 @@
 #include <Maestro.H>
 #include <Maestro_F.H>
 #include <MaestroPlot.H>
+#include <PlotFileStreamWriter.H>
 #include <AMReX_buildInfo.H>
 #include <iterator>     // std::istream_iterator
+#include <set>
+#include <algorithm>
 #include <unistd.h>     // getcwd
 
 using namespace amrex;
@@ -108,31 +111,86 @@ Maestro::WritePlotFile (const int step,
     int nPlot = 0;
     const auto& varnames = PlotFileVarNames(&nPlot);
 
-    const auto& mf = PlotFileMF(nPlot, t_in, dt_in, rho0_cart,rhoh0_cart, p0_cart,
-                                gamma1bar_cart, u_in, s_in,p0_in, gamma1bar_in,
-                                S_cc_in);
-
     // WriteMultiLevelPlotfile expects an array of step numbers
     Vector<int> step_array;
     step_array.resize(maxLevel()+1, step);
 
-    if (!is_small) {
+    if (!is_small && plot_chunk_size > 0 && plot_chunk_size < nPlot) {
+
+        // compute and write plot_chunk_size components at a time so the
+        // derived fields are never all in memory at once
+        Vector<BoxArray> plot_ba(finest_level+1);
+        Vector<DistributionMapping> plot_dm(finest_level+1);
+        for (int lev=0; lev<=finest_level; ++lev) {
+            plot_ba[lev] = s_in[lev].boxArray();
+            plot_dm[lev] = s_in[lev].DistributionMap();
+        }
+
+        PlotFileStreamWriter writer(plotfilename, plot_ba, plot_dm, nPlot);
+
+        for (int comp = 0; comp < nPlot; comp += plot_chunk_size) {
+            const int ncomp = amrex::min(plot_chunk_size, nPlot-comp);
+            Vector<std::string> chunk_varnames(varnames.begin()+comp,
+                                               varnames.begin()+comp+ncomp);
+
+            const auto& mf = PlotFileMF(nPlot, t_in, dt_in, rho0_cart,rhoh0_cart, p0_cart,
+                                        gamma1bar_cart, u_in, s_in,p0_in, gamma1bar_in,
+                                        S_cc_in, &chunk_varnames);
+
+            writer.WriteChunk(mf, comp);
+
+            for (int i = 0; i <= finest_level; ++i) {
+                delete mf[i];
+            }
+        }
+
+        writer.Finish(varnames, Geom(), t_in, step_array, refRatio());
+
+    } else if (!is_small) {
+
+        const auto& mf = PlotFileMF(nPlot, t_in, dt_in, rho0_cart,rhoh0_cart, p0_cart,
+                                    gamma1bar_cart, u_in, s_in,p0_in, gamma1bar_in,
+                                    S_cc_in);
+
         WriteMultiLevelPlotfile(plotfilename, finest_level+1, mf, varnames,
                                 Geom(), t_in, step_array, refRatio());
+
+        for (int i = 0; i <= finest_level; ++i) {
+            delete mf[i];
+        }
+
     } else {
+
         int nSmallPlot = 0;
         const auto& small_plot_varnames = SmallPlotFileVarNames(&nSmallPlot,
                                                                 varnames);
 
-        const auto& small_mf = SmallPlotFileMF(nPlot, nSmallPlot, mf, varnames,
+        // a small plotfile only computes the fields it writes; PlotFileMF
+        // returns them in the order of varnames
+        Vector<std::string> computed_varnames;
+        for (const auto& nm : varnames) {
+            if (std::find(small_plot_varnames.begin(), small_plot_varnames.end(), nm)
+                != small_plot_varnames.end()) {
+                computed_varnames.push_back(nm);
+            }
+        }
+
+        const auto& mf = PlotFileMF(nPlot, t_in, dt_in, rho0_cart,rhoh0_cart, p0_cart,
+                                    gamma1bar_cart, u_in, s_in,p0_in, gamma1bar_in,
+                                    S_cc_in, &computed_varnames);
+
+        const auto& small_mf = SmallPlotFileMF(computed_varnames.size(), nSmallPlot,
+                                               mf, computed_varnames,
                                                small_plot_varnames);
 
         WriteMultiLevelPlotfile(plotfilename, finest_level+1, small_mf,
                                 small_plot_varnames, Geom(), t_in, step_array,
                                 refRatio());
 
-        for (int i = 0; i <= finest_level; ++i)
+        for (int i = 0; i <= finest_level; ++i) {
+            delete mf[i];
             delete small_mf[i];
+        }
     }
 
     WriteJobInfo(plotfilename);
@@ -207,10 +265,6 @@ Maestro::WritePlotFile (const int step,
         Print() << "Time to write plotfile: " << end_total << '\n';
     }
 
-    for (int i = 0; i <= finest_level; ++i) {
-        delete mf[i];
-    }
-
 }
 
 
@@ -221,7 +275,10 @@ Maestro::PlotFileName (const int lev, std::string* plotfilename)
     *plotfilename = Concatenate(*plotfilename, lev, 7);
 }
 
-// put together a vector of multifabs for writing
+// put together a vector of multifabs for writing.  If plot_varnames is
+// given, only the fields named there (and whatever they are derived from)
+// are computed, and the returned MultiFabs hold just those components, in
+// the order they appear in PlotFileVarNames.
 Vector<const MultiFab*>
 Maestro::PlotFileMF (const int nPlot,
                      const Real t_in,
@@ -234,17 +291,83 @@ Maestro::PlotFileMF (const int nPlot,
                      Vector<MultiFab>& s_in,
                      const BaseState<Real>& p0_in,
                      const BaseState<Real>& gamma1bar_in,
-                     const Vector<MultiFab>& S_cc_in)
+                     const Vector<MultiFab>& S_cc_in,
+                     const Vector<std::string>* plot_varnames)
 {
     // timer for profiling
     BL_PROFILE_VAR("Maestro::PlotFileMF()", PlotFileMF);
 
+    // the names of every component, in the order they are filled below
+    int nPlotAll = 0;
+    const auto& varnames = PlotFileVarNames(&nPlotAll);
+    AMREX_ASSERT(nPlotAll == nPlot);
+
+    // the requested fields
+    std::set<std::string> wanted;
+    if (plot_varnames) {
+        wanted.insert(plot_varnames->begin(), plot_varnames->end());
+    } else {
+        wanted.insert(varnames.begin(), varnames.end());
+    }
+
+    // out_comp[n] is the component of the returned MultiFabs that holds
+    // component n of the full list, or -1 if it is not requested
+    Vector<int> out_comp(nPlot, -1);
+    int nOut = 0;
+    for (int n = 0; n < nPlot; ++n) {
+        if (wanted.count(varnames[n]) > 0) {
+            out_comp[n] = nOut++;
+        }
+    }
+
+    // is any of the ncomp components starting at comp requested?
+    auto want = [&] (const int comp, const int ncomp) {
+        for (int n = comp; n < comp+ncomp; ++n) {
+            if (out_comp[n] >= 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // is any field whose name starts with prefix requested?
+    auto want_prefix = [&] (const std::string& prefix) {
+        for (const auto& nm : wanted) {
+            if (nm.compare(0, prefix.size(), prefix) == 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // the expensive intermediate quantities, and the fields that need them
+    const bool need_react = want_prefix("omegadot(") ||
+        wanted.count("Hext") > 0 || wanted.count("Hnuc") > 0;
+    const bool need_w0r = wanted.count("MachNumber") > 0 ||
+        wanted.count("radial_velocity") > 0 || wanted.count("circ_velocity") > 0;
+    const bool need_w0mac = wanted.count("divw0") > 0;
+    const bool need_thermal = wanted.count("thermal") > 0 ||
+        wanted.count("conductivity") > 0;
+
     // MultiFab to hold plotfile data
     Vector<const MultiFab*> plot_mf;
 
     // temporary MultiFab to hold plotfile data
     Vector<MultiFab*> plot_mf_data(finest_level+1);
 
+    // copy ncomp components of src starting at scomp into the plotfile
+    // components starting at comp, skipping any that are not requested
+    auto copy_out = [&] (const Vector<MultiFab>& src, const int scomp,
+                         const int comp, const int ncomp) {
+        for (int n = 0; n < ncomp; ++n) {
+            if (out_comp[comp+n] >= 0) {
+                for (int i = 0; i <= finest_level; ++i) {
+                    plot_mf_data[i]->copy(src[i],scomp+n,out_comp[comp+n],1);
+                }
+            }
+        }
+    };
+
     // temporary MultiFab for calculations
     Vector<MultiFab> tempmf(finest_level+1);
     Vector<MultiFab> tempmf_scalar1(finest_level+1);
@@ -256,7 +379,7 @@ Maestro::PlotFileMF (const int nPlot,
 
     // build temporary MultiFab to hold plotfile data
     for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i] = new MultiFab((s_in[i]).boxArray(),(s_in[i]).DistributionMap(),nPlot,0);
+        plot_mf_data[i] = new MultiFab((s_in[i]).boxArray(),(s_in[i]).DistributionMap(),nOut,0);
         tempmf[i].define(grids[i],dmap[i],AMREX_SPACEDIM,0);
 
         tempmf_scalar1[i].define(grids[i],dmap[i],1,0);
@@ -264,71 +387,72 @@ Maestro::PlotFileMF (const int nPlot,
     }
 
     // velocity
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(u_in[i],0,dest_comp,AMREX_SPACEDIM);
-    }
+    copy_out(u_in,0,dest_comp,AMREX_SPACEDIM);
     dest_comp += AMREX_SPACEDIM;
 
     // magvel
-    MakeMagvel(u_in, tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+    if (want(dest_comp,2)) {
+        MakeMagvel(u_in, tempmf);
     }
+    copy_out(tempmf,0,dest_comp,1);
     ++dest_comp;
 
     // momentum = magvel * rho
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-        MultiFab::Multiply(*plot_mf_data[i], s_in[i], Rho, dest_comp, 1, 0);
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
+        for (int i = 0; i <= finest_level; ++i) {
+            plot_mf_data[i]->copy(tempmf[i],0,dc,1);
+            MultiFab::Multiply(*plot_mf_data[i], s_in[i], Rho, dc, 1, 0);
+        }
     }
     ++dest_comp;
 
     // vorticity
-    MakeVorticity(u_in, tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+    if (want(dest_comp,1)) {
+        MakeVorticity(u_in, tempmf);
+        copy_out(tempmf,0,dest_comp,1);
     }
     ++dest_comp;
 
     // rho
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Rho,dest_comp,1);
-    }
+    copy_out(s_in,Rho,dest_comp,1);
     ++dest_comp;
 
     // rhoh
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],RhoH,dest_comp,1);
-    }
+    copy_out(s_in,RhoH,dest_comp,1);
     ++dest_comp;
 
     // h
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],RhoH,dest_comp,1);
-        MultiFab::Divide(*plot_mf_data[i], s_in[i], Rho, dest_comp, 1, 0);
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
+        for (int i = 0; i <= finest_level; ++i) {
+            plot_mf_data[i]->copy(s_in[i],RhoH,dc,1);
+            MultiFab::Divide(*plot_mf_data[i], s_in[i], Rho, dc, 1, 0);
+        }
     }
     ++dest_comp;
 
     // rhoX
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],FirstSpec,dest_comp,NumSpec);
-    }
+    copy_out(s_in,FirstSpec,dest_comp,NumSpec);
     dest_comp += NumSpec;
 
     if (plot_spec) {
         // X
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(s_in[i],FirstSpec,dest_comp,NumSpec);
-            for (int comp=0; comp<NumSpec; ++comp) {
-                MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dest_comp+comp,1,0);
+        copy_out(s_in,FirstSpec,dest_comp,NumSpec);
+        for (int comp=0; comp<NumSpec; ++comp) {
+            const int dc = out_comp[dest_comp+comp];
+            if (dc >= 0) {
+                for (int i = 0; i <= finest_level; ++i) {
+                    MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dc,1,0);
+                }
             }
         }
         dest_comp += NumSpec;
 
         // abar
-        MakeAbar(s_in, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (want(dest_comp,1)) {
+            MakeAbar(s_in, tempmf);
+            copy_out(tempmf,0,dest_comp,1);
         }
         ++dest_comp;
 
@@ -340,39 +464,44 @@ Maestro::PlotFileMF (const int nPlot,
     Vector<MultiFab> rho_Hnuc          (finest_level+1);
     Vector<MultiFab> sdc_source        (finest_level+1);
 
-    for (int lev=0; lev<=finest_level; ++lev) {
-        stemp             [lev].define(grids[lev], dmap[lev],   Nscal, 0);
-        rho_Hext          [lev].define(grids[lev], dmap[lev],       1, 0);
-        rho_omegadot      [lev].define(grids[lev], dmap[lev], NumSpec, 0);
-        rho_Hnuc          [lev].define(grids[lev], dmap[lev],       1, 0);
-        sdc_source        [lev].define(grids[lev], dmap[lev],   Nscal, 0);
-        
-        sdc_source[lev].setVal(0.);
-    }
+    if (need_react) {
+        for (int lev=0; lev<=finest_level; ++lev) {
+            stemp             [lev].define(grids[lev], dmap[lev],   Nscal, 0);
+            rho_Hext          [lev].define(grids[lev], dmap[lev],       1, 0);
+            rho_omegadot      [lev].define(grids[lev], dmap[lev], NumSpec, 0);
+            rho_Hnuc          [lev].define(grids[lev], dmap[lev],       1, 0);
+            sdc_source        [lev].define(grids[lev], dmap[lev],   Nscal, 0);
+
+            sdc_source[lev].setVal(0.);
+        }
 
 #ifndef SDC
-    if (dt_in < small_dt) {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, small_dt, t_in);
-    } else {
-        React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt_in*0.5, t_in);
-    }
+        if (dt_in < small_dt) {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, small_dt, t_in);
+        } else {
+            React(s_in, stemp, rho_Hext, rho_omegadot, rho_Hnuc, p0_in, dt_in*0.5, t_in);
+        }
 #else   
-    if (dt_in < small_dt) {
-        ReactSDC(s_in, stemp, rho_Hext, p0_in, small_dt, t_in, sdc_source);
-    } else {
-        ReactSDC(s_in, stemp, rho_Hext, p0_in, dt_in*0.5, t_in, sdc_source);
-    }
-    
-    MakeReactionRates(rho_omegadot,rho_Hnuc,s_in);
+        if (dt_in < small_dt) {
+            ReactSDC(s_in, stemp, rho_Hext, p0_in, small_dt, t_in, sdc_source);
+        } else {
+            ReactSDC(s_in, stemp, rho_Hext, p0_in, dt_in*0.5, t_in, sdc_source);
+        }
+
+        MakeReactionRates(rho_omegadot,rho_Hnuc,s_in);
 #endif
+    }
 
     if (plot_spec || plot_omegadot) {
         // omegadot
         if (plot_omegadot) {
-            for (int i = 0; i <= finest_level; ++i) {
-                plot_mf_data[i]->copy(rho_omegadot[i],0,dest_comp,NumSpec);
-                for (int comp=0; comp<NumSpec; ++comp) {
-                    MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dest_comp+comp,1,0);
+            copy_out(rho_omegadot,0,dest_comp,NumSpec);
+            for (int comp=0; comp<NumSpec; ++comp) {
+                const int dc = out_comp[dest_comp+comp];
+                if (dc >= 0) {
+                    for (int i = 0; i <= finest_level; ++i) {
+                        MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dc,1,0);
+                    }
                 }
             }
             dest_comp += NumSpec;
@@ -381,146 +510,174 @@ Maestro::PlotFileMF (const int nPlot,
 
     if (plot_Hext) {
         // Hext
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(rho_Hext[i],0,dest_comp,1);
-            MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dest_comp,1,0);
+        if (want(dest_comp,1)) {
+            const int dc = out_comp[dest_comp];
+            for (int i = 0; i <= finest_level; ++i) {
+                plot_mf_data[i]->copy(rho_Hext[i],0,dc,1);
+                MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dc,1,0);
+            }
         }
         ++dest_comp;
     }
 
     if (plot_Hnuc) {
         // Hnuc
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(rho_Hnuc[i],0,dest_comp,1);
-            MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dest_comp,1,0);
+        if (want(dest_comp,1)) {
+            const int dc = out_comp[dest_comp];
+            for (int i = 0; i <= finest_level; ++i) {
+                plot_mf_data[i]->copy(rho_Hnuc[i],0,dc,1);
+                MultiFab::Divide(*plot_mf_data[i],s_in[i],Rho,dc,1,0);
+            }
         }
         ++dest_comp;
     }
 
     if (plot_eta) {
         // eta_rho
-        Put1dArrayOnCart(etarho_cc,tempmf,1,0,bcs_u,0,1);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (want(dest_comp,1)) {
+            Put1dArrayOnCart(etarho_cc,tempmf,1,0,bcs_u,0,1);
+            copy_out(tempmf,0,dest_comp,1);
         }
         ++dest_comp;
     }
 
-    // compute tfromp
-    TfromRhoP(s_in, p0_in);
     // tfromp
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Temp,dest_comp,1);
+    if (want(dest_comp,1)) {
+        // compute tfromp
+        TfromRhoP(s_in, p0_in);
+        copy_out(s_in,Temp,dest_comp,1);
     }
     ++dest_comp;
 
-    // compute tfromh
-    TfromRhoH(s_in, p0_in);
-    for (int i = 0; i <= finest_level; ++i) {
-        // tfromh
-        plot_mf_data[i]->copy(s_in[i],Temp,dest_comp,1);
+    // tfromh
+    if (want(dest_comp,1)) {
+        // compute tfromh
+        TfromRhoH(s_in, p0_in);
+        copy_out(s_in,Temp,dest_comp,1);
     }
     ++dest_comp;
 
     // deltap
-    // compute & copy tfromp
-    PfromRhoH(s_in,s_in,tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        // tfromh
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-        MultiFab::Subtract(*plot_mf_data[i],p0_cart[i],0,dest_comp,1,0);
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
+        PfromRhoH(s_in,s_in,tempmf);
+        for (int i = 0; i <= finest_level; ++i) {
+            plot_mf_data[i]->copy(tempmf[i],0,dc,1);
+            MultiFab::Subtract(*plot_mf_data[i],p0_cart[i],0,dc,1,0);
+        }
     }
     ++dest_comp;
 
     // deltaT
-    // compute & copy tfromp
-    TfromRhoP(s_in, p0_in);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Temp,dest_comp,1);
-    }
-    // compute tfromh
-    TfromRhoH(s_in, p0_in);
-    // compute deltaT = (tfromp - tfromh) / tfromh
-    for (int i = 0; i <= finest_level; ++i) {
-        MultiFab::Subtract(*plot_mf_data[i],s_in[i],Temp,dest_comp,1,0);
-        MultiFab::Divide(*plot_mf_data[i],s_in[i],Temp,dest_comp,1,0);
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
+        // compute & copy tfromp
+        TfromRhoP(s_in, p0_in);
+        for (int i = 0; i <= finest_level; ++i) {
+            plot_mf_data[i]->copy(s_in[i],Temp,dc,1);
+        }
+        // compute tfromh
+        TfromRhoH(s_in, p0_in);
+        // compute deltaT = (tfromp - tfromh) / tfromh
+        for (int i = 0; i <= finest_level; ++i) {
+            MultiFab::Subtract(*plot_mf_data[i],s_in[i],Temp,dc,1,0);
+            MultiFab::Divide(*plot_mf_data[i],s_in[i],Temp,dc,1,0);
+        }
     }
     ++dest_comp;
 
-    // restore tfromp if necessary
+    // the temperature left in s_in is used below and by the rest of the
+    // run, so always leave tfromp or tfromh there no matter which of the
+    // fields above were computed
     if (use_tfromp) {
         TfromRhoP(s_in, p0_in);
+    } else {
+        TfromRhoH(s_in, p0_in);
     }
 
     // pi
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Pi,dest_comp,1);
-    }
+    copy_out(s_in,Pi,dest_comp,1);
     ++dest_comp;
 
     // pioverp0
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Pi,dest_comp,1);
-        MultiFab::Divide(*plot_mf_data[i], p0_cart[i], 0, dest_comp, 1, 0);
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
+        for (int i = 0; i <= finest_level; ++i) {
+            plot_mf_data[i]->copy(s_in[i],Pi,dc,1);
+            MultiFab::Divide(*plot_mf_data[i], p0_cart[i], 0, dc, 1, 0);
+        }
     }
     ++dest_comp;
 
     // p0pluspi
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Pi,dest_comp,1);
-        MultiFab::Add(*plot_mf_data[i], p0_cart[i], 0, dest_comp, 1, 0);
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
+        for (int i = 0; i <= finest_level; ++i) {
+            plot_mf_data[i]->copy(s_in[i],Pi,dc,1);
+            MultiFab::Add(*plot_mf_data[i], p0_cart[i], 0, dc, 1, 0);
+        }
     }
     ++dest_comp;
 
     if (plot_gpi) {
         // gpi
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(gpi[i],0,dest_comp,AMREX_SPACEDIM);
-        }
+        copy_out(gpi,0,dest_comp,AMREX_SPACEDIM);
         dest_comp += AMREX_SPACEDIM;
     }
 
     // rhopert
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],Rho,dest_comp,1);
-        MultiFab::Subtract(*plot_mf_data[i],rho0_cart[i],0,dest_comp,1,0);
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
+        for (int i = 0; i <= finest_level; ++i) {
+            plot_mf_data[i]->copy(s_in[i],Rho,dc,1);
+            MultiFab::Subtract(*plot_mf_data[i],rho0_cart[i],0,dc,1,0);
+        }
     }
     ++dest_comp;
 
     // rhohpert
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(s_in[i],RhoH,dest_comp,1);
-        MultiFab::Subtract(*plot_mf_data[i],rhoh0_cart[i],0,dest_comp,1,0);
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
+        for (int i = 0; i <= finest_level; ++i) {
+            plot_mf_data[i]->copy(s_in[i],RhoH,dc,1);
+            MultiFab::Subtract(*plot_mf_data[i],rhoh0_cart[i],0,dc,1,0);
+        }
     }
     ++dest_comp;
 
     // tpert
-    {
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
         Average(s_in, tempbar_plot, Temp);
         Put1dArrayOnCart(tempbar_plot, tempmf, 0, 0, bcs_f, 0);
 
         for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(s_in[i],Temp,dest_comp,1);
-            MultiFab::Subtract(*plot_mf_data[i],tempmf[i],0,dest_comp,1,0);
+            plot_mf_data[i]->copy(s_in[i],Temp,dc,1);
+            MultiFab::Subtract(*plot_mf_data[i],tempmf[i],0,dc,1,0);
         }
     }
     ++dest_comp;
 
     if (plot_base_state) {
-        // rho0, rhoh0, h0 and p0
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy( rho0_cart[i],0,dest_comp,1);
-            plot_mf_data[i]->copy(rhoh0_cart[i],0,dest_comp+1,1);
-            plot_mf_data[i]->copy(rhoh0_cart[i],0,dest_comp+2,1);
-
-            // we have to use protected_divide here to guard against division by zero
-            // in the case that there are zeros rho0
-            MultiFab& plot_mf_data_mf = *plot_mf_data[i];
-            for ( MFIter mfi(plot_mf_data_mf); mfi.isValid(); ++mfi ) {
-                plot_mf_data_mf[mfi].protected_divide<RunOn::Device>(plot_mf_data_mf[mfi], dest_comp, dest_comp+2);
+        // rho0, rhoh0 and p0
+        copy_out(rho0_cart,0,dest_comp,1);
+        copy_out(rhoh0_cart,0,dest_comp+1,1);
+        copy_out(p0_cart,0,dest_comp+3,1);
+
+        // h0 = rhoh0 / rho0
+        if (want(dest_comp+2,1)) {
+            const int dc = out_comp[dest_comp+2];
+            for (int i = 0; i <= finest_level; ++i) {
+                MultiFab& plot_mf_data_mf = *plot_mf_data[i];
+                for ( MFIter mfi(plot_mf_data_mf); mfi.isValid(); ++mfi ) {
+                    const Box& bx = mfi.validbox();
+                    plot_mf_data_mf[mfi].copy<RunOn::Device>(rhoh0_cart[i][mfi], bx, 0, bx, dc, 1);
+
+                    // we have to use protected_divide here to guard against division by zero
+                    // in the case that there are zeros rho0
+                    plot_mf_data_mf[mfi].protected_divide<RunOn::Device>(rho0_cart[i][mfi], bx, bx, 0, dc, 1);
+                }
             }
-
-            plot_mf_data[i]->copy(p0_cart[i],0,dest_comp+3,1);
         }
         dest_comp += 4;
     }
@@ -549,113 +706,112 @@ Maestro::PlotFileMF (const int nPlot,
 
     if (evolve_base_state) {
 #if (AMREX_SPACEDIM == 3)
-        if (spherical) {
+        if (spherical && need_w0mac) {
             MakeW0mac(w0mac);
         }
 #endif
-        Put1dArrayOnCart(w0, w0r_cart, 1, 0, bcs_u, 0);
+        if (need_w0r) {
+            Put1dArrayOnCart(w0, w0r_cart, 1, 0, bcs_u, 0);
+        }
     }
 
-    // Mach number
-    MachfromRhoH(s_in, u_in, p0_in, w0r_cart, tempmf);
-
     // MachNumber
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+    if (want(dest_comp,1)) {
+        MachfromRhoH(s_in, u_in, p0_in, w0r_cart, tempmf);
+        copy_out(tempmf,0,dest_comp,1);
     }
     ++dest_comp;
 
     // deltagamma
-    MakeDeltaGamma(s_in, p0_in, p0_cart, gamma1bar_in, gamma1bar_cart, tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+    if (want(dest_comp,1)) {
+        MakeDeltaGamma(s_in, p0_in, p0_cart, gamma1bar_in, gamma1bar_cart, tempmf);
+        copy_out(tempmf,0,dest_comp,1);
     }
     ++dest_comp;
 
     // entropy
-    MakeEntropy(s_in, tempmf);
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+    if (want(dest_comp,2)) {
+        MakeEntropy(s_in, tempmf);
     }
+    copy_out(tempmf,0,dest_comp,1);
     ++dest_comp;
 
     // entropypert = (entropy - entropybar) / entropybar
-    {
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
         for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+            plot_mf_data[i]->copy(tempmf[i],0,dc,1);
         }
 
         Average(tempmf, tempbar_plot, 0);
         Put1dArrayOnCart(tempbar_plot, tempmf, 0, 0, bcs_f, 0);
 
         for (int i = 0; i <= finest_level; ++i) {
-            MultiFab::Subtract(*plot_mf_data[i],tempmf[i],0,dest_comp,1,0);
-            MultiFab::Divide(*plot_mf_data[i],tempmf[i],0,dest_comp,1,0);
+            MultiFab::Subtract(*plot_mf_data[i],tempmf[i],0,dc,1,0);
+            MultiFab::Divide(*plot_mf_data[i],tempmf[i],0,dc,1,0);
         }
     }
     ++dest_comp;
 
     if (plot_pidivu) {
         // pidivu
-        MakePiDivu(u_in, s_in, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (want(dest_comp,1)) {
+            MakePiDivu(u_in, s_in, tempmf);
+            copy_out(tempmf,0,dest_comp,1);
         }
         ++dest_comp;
     }
 
     // processor number of each tile
     if (plot_processors) {
-        for (int i = 0; i <= finest_level; ++i) {
-            (*plot_mf_data[i]).setVal(ParallelDescriptor::MyProc());
+        if (want(dest_comp,1)) {
+            for (int i = 0; i <= finest_level; ++i) {
+                (*plot_mf_data[i]).setVal(ParallelDescriptor::MyProc(),out_comp[dest_comp],1);
+            }
         }
         ++dest_comp;
     }
 
     if (plot_ad_excess) {
         // ad_excess
-        MakeAdExcess(s_in, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (want(dest_comp,1)) {
+            MakeAdExcess(s_in, tempmf);
+            copy_out(tempmf,0,dest_comp,1);
         }
         ++dest_comp;
     }
 
     // S
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(S_cc_in[i],0,dest_comp,1);
-    }
+    copy_out(S_cc_in,0,dest_comp,1);
     ++dest_comp;
 
     // soundspeed
     if (plot_cs) {
-        CsfromRhoH(s_in, p0_cart, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (want(dest_comp,1)) {
+            CsfromRhoH(s_in, p0_cart, tempmf);
+            copy_out(tempmf,0,dest_comp,1);
         }
         ++dest_comp;
     }
 
     // gravitational_acceleration
     if (plot_grav) {
-        MakeGrav(rho0_new, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (want(dest_comp,1)) {
+            MakeGrav(rho0_new, tempmf);
+            copy_out(tempmf,0,dest_comp,1);
         }
         ++dest_comp;
     }
 
     if (plot_base_state) {
         // w0
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(w0_cart[i],0,dest_comp,AMREX_SPACEDIM);
-        }
+        copy_out(w0_cart,0,dest_comp,AMREX_SPACEDIM);
         dest_comp += AMREX_SPACEDIM;
 
         // divw0
-        MakeDivw0(w0mac, tempmf);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (want(dest_comp,1)) {
+            MakeDivw0(w0mac, tempmf);
+            copy_out(tempmf,0,dest_comp,1);
         }
         dest_comp++;
     }
@@ -666,69 +822,73 @@ Maestro::PlotFileMF (const int nPlot,
     Vector<MultiFab> Xkcoeff           (finest_level+1);
     Vector<MultiFab> pcoeff            (finest_level+1);
 
-    for (int lev=0; lev<=finest_level; ++lev) {
-        Tcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
-        hcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
-        Xkcoeff           [lev].define(grids[lev], dmap[lev], NumSpec, 1);
-        pcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
-    }
-
-    if (use_thermal_diffusion) {
-        MakeThermalCoeffs(s_in,Tcoeff,hcoeff,Xkcoeff,pcoeff);
-        MakeExplicitThermal(tempmf,s_in,Tcoeff,hcoeff,Xkcoeff,pcoeff,p0_in,0);
-    } else {
+    if (need_thermal) {
         for (int lev=0; lev<=finest_level; ++lev) {
-            Tcoeff[lev].setVal(0.);
-            tempmf[lev].setVal(0.);
+            Tcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
+            hcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
+            Xkcoeff           [lev].define(grids[lev], dmap[lev], NumSpec, 1);
+            pcoeff            [lev].define(grids[lev], dmap[lev],       1, 1);
+        }
+
+        if (use_thermal_diffusion) {
+            MakeThermalCoeffs(s_in,Tcoeff,hcoeff,Xkcoeff,pcoeff);
+            MakeExplicitThermal(tempmf,s_in,Tcoeff,hcoeff,Xkcoeff,pcoeff,p0_in,0);
+        } else {
+            for (int lev=0; lev<=finest_level; ++lev) {
+                Tcoeff[lev].setVal(0.);
+                tempmf[lev].setVal(0.);
+            }
         }
     }
-    for (int i = 0; i <= finest_level; ++i) {
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-    }
+    copy_out(tempmf,0,dest_comp,1);
     dest_comp++;
 
     // conductivity
-    for (int i = 0; i <= finest_level; ++i) {
-        tempmf[i].setVal(0.);
-        plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-        MultiFab::Subtract(*plot_mf_data[i],Tcoeff[i],0,dest_comp,1,0);
+    if (want(dest_comp,1)) {
+        const int dc = out_comp[dest_comp];
+        for (int i = 0; i <= finest_level; ++i) {
+            plot_mf_data[i]->setVal(0.,dc,1);
+            MultiFab::Subtract(*plot_mf_data[i],Tcoeff[i],0,dc,1,0);
+        }
     }
     dest_comp++;
 
     // radial and circular velocities
     if (spherical) {
-        MakeVelrc(u_in, w0r_cart, tempmf, tempmf_scalar1);
-        for (int i = 0; i <= finest_level; ++i) {
-            plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
-            plot_mf_data[i]->copy(tempmf_scalar1[i],0,dest_comp+1,1);
+        if (want(dest_comp,2)) {
+            MakeVelrc(u_in, w0r_cart, tempmf, tempmf_scalar1);
+            copy_out(tempmf,0,dest_comp,1);
+            copy_out(tempmf_scalar1,0,dest_comp+1,1);
         }
         dest_comp += 2;
     }
 
     if (do_sponge) {
         SpongeInit(rho0_old);
-        MakeSponge(tempmf);
 
-        if (plot_sponge_fdamp) {
-            // compute f_damp assuming sponge=1/(1+dt*kappa*fdamp)
-            // therefore fdamp = (1/sponge-1)/(dt*kappa)
-            for (int i = 0; i <= finest_level; ++i) {
-                // scalar1 = 1
-                tempmf_scalar1[i].setVal(1.);
-                // scalar2 = dt * kappa
-                tempmf_scalar2[i].setVal(dt * sponge_kappa);
-                // plot_mf = 1
-                plot_mf_data[i]->copy(tempmf_scalar1[i],0,dest_comp,1);
-                // plot_mf = 1/sponge
-                MultiFab::Divide(*plot_mf_data[i],tempmf[i],0,dest_comp,1,0);
-                // plot_mf = 1/sponge - 1
-                MultiFab::Subtract(*plot_mf_data[i],tempmf_scalar1[i],0,dest_comp,1,0);
-                // plot_mf = (1/sponge-1)/(dt*kappa)
-                MultiFab::Divide(*plot_mf_data[i],tempmf_scalar2[i],0,dest_comp,1,0);
-            }
-        } else {
-            for (int i = 0; i <= finest_level; ++i) {
-                plot_mf_data[i]->copy(tempmf[i],0,dest_comp,1);
+        if (want(dest_comp,1)) {
+            const int dc = out_comp[dest_comp];
+            MakeSponge(tempmf);
+
+            if (plot_sponge_fdamp) {
+                // compute f_damp assuming sponge=1/(1+dt*kappa*fdamp)
+                // therefore fdamp = (1/sponge-1)/(dt*kappa)
+                for (int i = 0; i <= finest_level; ++i) {
+                    // scalar1 = 1
+                    tempmf_scalar1[i].setVal(1.);
+                    // scalar2 = dt * kappa
+                    tempmf_scalar2[i].setVal(dt * sponge_kappa);
+                    // plot_mf = 1
+                    plot_mf_data[i]->copy(tempmf_scalar1[i],0,dc,1);
+                    // plot_mf = 1/sponge
+                    MultiFab::Divide(*plot_mf_data[i],tempmf[i],0,dc,1,0);
+                    // plot_mf = 1/sponge - 1
+                    MultiFab::Subtract(*plot_mf_data[i],tempmf_scalar1[i],0,dc,1,0);
+                    // plot_mf = (1/sponge-1)/(dt*kappa)
+                    MultiFab::Divide(*plot_mf_data[i],tempmf_scalar2[i],0,dc,1,0);
+                }
+            } else {
+                copy_out(tempmf,0,dest_comp,1);
             }
         }
         dest_comp++;
@@ -3,6 +3,9 @@
 #include <Maestro_F.H>
 #include <Maestro_F.H>
 
+#include <algorithm>
+#include <numeric>
+
 using namespace amrex;
 
 // compute heating term, rho_Hext, then
@@ -195,20 +198,51 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
         }
     }
 
-    RealVector tempbar_init_vec((base_geom.max_radial_level+1)*base_geom.nr_fine);
-    if (!spherical) {
-        tempbar_init.toVector(tempbar_init_vec);
-    }
+    // burner_loop reads tempbar_init in place; its Fortran bounds
+    // (0:nr_fine-1,0:max_radial_level) match the BaseState layout
+    const Real* tempbar_init_p = tempbar_init.dataPtr();
 
     for (int lev=0; lev<=finest_level; ++lev) {
 
+        // with burner_lb_type = 2 we burn on a copy of the state that is
+        // distributed according to the measured burner cost
+        const bool shuffle = burner_lb_type == 2 &&
+            burn_dmap[lev].size() == grids[lev].size() &&
+            burn_dmap[lev] != dmap[lev];
+
+        MultiFab s_in_b, s_out_b, rho_Hext_b, rho_omegadot_b, rho_Hnuc_b, tempbar_cart_b;
+
+        if (shuffle) {
+            const DistributionMapping& bdm = burn_dmap[lev];
+
+            s_in_b        .define(grids[lev], bdm,   Nscal, 0);
+            s_out_b       .define(grids[lev], bdm,   Nscal, 0);
+            rho_Hext_b    .define(grids[lev], bdm,       1, 0);
+            rho_omegadot_b.define(grids[lev], bdm, NumSpec, 0);
+            rho_Hnuc_b    .define(grids[lev], bdm,       1, 0);
+
+            s_in_b    .ParallelCopy(    s_in[lev], 0, 0, Nscal);
+            rho_Hext_b.ParallelCopy(rho_Hext[lev], 0, 0,     1);
+
+            // cells covered by finer grids are not touched by the burner,
+            // so the outputs need their current values as well
+            s_out_b       .ParallelCopy(       s_out[lev], 0, 0,   Nscal);
+            rho_omegadot_b.ParallelCopy(rho_omegadot[lev], 0, 0, NumSpec);
+            rho_Hnuc_b    .ParallelCopy(    rho_Hnuc[lev], 0, 0,       1);
+
+            if (spherical) {
+                tempbar_cart_b.define(grids[lev], bdm, 1, 0);
+                tempbar_cart_b.ParallelCopy(tempbar_init_cart[lev], 0, 0, 1);
+            }
+        }
+
         // get references to the MultiFabs at level lev
-        const MultiFab&         s_in_mf =         s_in[lev];
-        MultiFab&        s_out_mf =        s_out[lev];
-        const MultiFab&     rho_Hext_mf =     rho_Hext[lev];
-        MultiFab& rho_omegadot_mf = rho_omegadot[lev];
-        MultiFab&     rho_Hnuc_mf =     rho_Hnuc[lev];
-        const MultiFab& tempbar_cart_mf = tempbar_init_cart[lev];
+        const MultiFab&         s_in_mf = shuffle ?         s_in_b :         s_in[lev];
+        MultiFab&              s_out_mf = shuffle ?        s_out_b :        s_out[lev];
+        const MultiFab&     rho_Hext_mf = shuffle ?     rho_Hext_b :     rho_Hext[lev];
+        MultiFab&       rho_omegadot_mf = shuffle ? rho_omegadot_b : rho_omegadot[lev];
+        MultiFab&           rho_Hnuc_mf = shuffle ?     rho_Hnuc_b :     rho_Hnuc[lev];
+        const MultiFab& tempbar_cart_mf = shuffle ? tempbar_cart_b : tempbar_init_cart[lev];
 
         // create mask assuming refinement ratio = 2
         int finelev = lev+1;
@@ -217,6 +251,28 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
         const BoxArray& fba = s_in[finelev].boxArray();
         const iMultiFab& mask = makeFineMask(s_in_mf, fba, IntVect(2));
 
+        // measure the cost of the burn for load balancing
+        const bool record_cost = burner_lb_type > 0;
+        if (record_cost && !(burn_cost[lev].ok() && isMFIterSafe(burn_cost[lev], s_in_mf))) {
+            burn_cost[lev].define(s_in_mf.boxArray(), s_in_mf.DistributionMap(), 1, 0);
+            burn_cost[lev].setVal(0.);
+        }
+
+        int use_mask = !(lev==finest_level);
+
+        // with burner_schedule_type = 1 the cells that are burned are
+        // collected into a work list and burned after the tile loop with
+        // dynamic scheduling, so the tile loop only passes through the rest
+        const bool use_work_list = burner_schedule_type == 1 && Gpu::notInLaunchRegion();
+
+        iMultiFab skip;
+        Vector<int> cell_box;
+        Vector<IntVect> cells;
+        if (use_work_list) {
+            MakeBurnerWorkList(s_in_mf, mask, use_mask, skip, cell_box, cells);
+        }
+        const iMultiFab& tile_mask = use_work_list ? skip : mask;
+        const int tile_use_mask = use_work_list ? 1 : use_mask;
 
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -227,7 +283,7 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
 
-            int use_mask = !(lev==finest_level);
+            const Real strt_burn = record_cost ? ParallelDescriptor::second() : 0.0;
 
             // call fortran subroutine
             // use macros in AMReX_ArrayLim.H to pass in each FAB's data,
@@ -242,7 +298,7 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
                                  BL_TO_FORTRAN_ANYD(rho_omegadot_mf[mfi]),
                                  BL_TO_FORTRAN_ANYD(rho_Hnuc_mf[mfi]),
                                  BL_TO_FORTRAN_ANYD(tempbar_cart_mf[mfi]), dt_in, time_in, 
-                                 BL_TO_FORTRAN_ANYD(mask[mfi]), use_mask);
+                                 BL_TO_FORTRAN_ANYD(tile_mask[mfi]), tile_use_mask);
             } else {
 #pragma gpu box(tileBox)
                 burner_loop(AMREX_INT_ANYD(tileBox.loVect()), AMREX_INT_ANYD(tileBox.hiVect()),
@@ -252,9 +308,63 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
                             BL_TO_FORTRAN_ANYD(rho_Hext_mf[mfi]),
                             BL_TO_FORTRAN_ANYD(rho_omegadot_mf[mfi]),
                             BL_TO_FORTRAN_ANYD(rho_Hnuc_mf[mfi]),
-                            tempbar_init_vec.dataPtr(), dt_in, time_in, 
-                            BL_TO_FORTRAN_ANYD(mask[mfi]), use_mask);
+                            tempbar_init_p, dt_in, time_in, 
+                            BL_TO_FORTRAN_ANYD(tile_mask[mfi]), tile_use_mask);
             }
+
+            if (record_cost) {
+                AddBurnCost(lev, mfi, tileBox, strt_burn);
+            }
+        }
+
+        if (use_work_list) {
+            const int ncells = cells.size();
+            const int chunk_size = amrex::max(burner_chunk_size, 1);
+
+            // burn the work list one cell at a time; none of these cells
+            // are covered by finer cells, so the mask is not needed
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, chunk_size)
+#endif
+            for (int n = 0; n < ncells; ++n) {
+
+                const int K = cell_box[n];
+                const Box cellBox(cells[n], cells[n]);
+
+                const Real strt_burn = record_cost ? ParallelDescriptor::second() : 0.0;
+
+                if (spherical) {
+                    burner_loop_sphr(AMREX_INT_ANYD(cellBox.loVect()), AMREX_INT_ANYD(cellBox.hiVect()),
+                                     BL_TO_FORTRAN_ANYD(s_in_mf[K]),
+                                     BL_TO_FORTRAN_ANYD(s_out_mf[K]),
+                                     BL_TO_FORTRAN_ANYD(rho_Hext_mf[K]),
+                                     BL_TO_FORTRAN_ANYD(rho_omegadot_mf[K]),
+                                     BL_TO_FORTRAN_ANYD(rho_Hnuc_mf[K]),
+                                     BL_TO_FORTRAN_ANYD(tempbar_cart_mf[K]), dt_in, time_in, 
+                                     BL_TO_FORTRAN_ANYD(mask[K]), 0);
+                } else {
+                    burner_loop(AMREX_INT_ANYD(cellBox.loVect()), AMREX_INT_ANYD(cellBox.hiVect()),
+                                lev,
+                                BL_TO_FORTRAN_ANYD(s_in_mf[K]),
+                                BL_TO_FORTRAN_ANYD(s_out_mf[K]),
+                                BL_TO_FORTRAN_ANYD(rho_Hext_mf[K]),
+                                BL_TO_FORTRAN_ANYD(rho_omegadot_mf[K]),
+                                BL_TO_FORTRAN_ANYD(rho_Hnuc_mf[K]),
+                                tempbar_init_p, dt_in, time_in, 
+                                BL_TO_FORTRAN_ANYD(mask[K]), 0);
+                }
+
+                if (record_cost) {
+                    const Dim3 c = cells[n].dim3();
+                    burn_cost[lev].array(K)(c.x,c.y,c.z) += ParallelDescriptor::second() - strt_burn;
+                }
+            }
+        }
+
+        if (shuffle) {
+            s_out[lev]       .ParallelCopy(       s_out_b, 0, 0,   Nscal);
+            rho_omegadot[lev].ParallelCopy(rho_omegadot_b, 0, 0, NumSpec);
+            rho_Hnuc[lev]    .ParallelCopy(    rho_Hnuc_b, 0, 0,       1);
         }
     }
 }
@@ -273,8 +383,9 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
 
     Vector<MultiFab> p0_cart(finest_level+1);
 
-    // make a Fortran-friendly RealVector of p0
-    RealVector p0_vec((base_geom.max_radial_level+1)*base_geom.nr_fine);
+    // burner_loop reads p0 in place; its Fortran bounds
+    // (0:nr_fine-1,0:max_radial_level) match the BaseState layout
+    const Real* p0_p = p0.dataPtr();
 
     if (spherical) {
         for (int lev=0; lev<=finest_level; ++lev) {
@@ -283,19 +394,43 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
         }
 
         Put1dArrayOnCart(p0, p0_cart, 0, 0, bcs_f, 0);
-    } else {
-        // need non-constant basestate to apply toVector()
-        BaseState<Real> p0_var(p0);
-        p0_var.toVector(p0_vec);
     }
 
     for (int lev=0; lev<=finest_level; ++lev) {
 
+        // with burner_lb_type = 2 we burn on a copy of the state that is
+        // distributed according to the measured burner cost
+        const bool shuffle = burner_lb_type == 2 &&
+            burn_dmap[lev].size() == grids[lev].size() &&
+            burn_dmap[lev] != dmap[lev];
+
+        MultiFab s_in_b, s_out_b, p0_cart_b, source_b;
+
+        if (shuffle) {
+            const DistributionMapping& bdm = burn_dmap[lev];
+
+            s_in_b  .define(grids[lev], bdm, Nscal, 0);
+            s_out_b .define(grids[lev], bdm, Nscal, 0);
+            source_b.define(grids[lev], bdm, Nscal, 0);
+
+            s_in_b  .ParallelCopy(  s_in[lev], 0, 0, Nscal);
+            source_b.ParallelCopy(source[lev], 0, 0, Nscal);
+
+            // cells covered by finer grids are not touched by the burner,
+            // so the output needs its current values as well
+            s_out_b.ParallelCopy(s_out[lev], 0, 0, Nscal);
+
+            if (spherical) {
+                p0_cart_b.define(grids[lev], bdm, 1, 0);
+                p0_cart_b.ParallelCopy(p0_cart[lev], 0, 0, 1);
+            }
+        }
+
         // get references to the MultiFabs at level lev
-        const MultiFab&    s_in_mf =    s_in[lev];
-              MultiFab&   s_out_mf =   s_out[lev];
-        const MultiFab& p0_cart_mf = p0_cart[lev];
-        const MultiFab&  source_mf =  source[lev];
+        const MultiFab&    s_in_mf = shuffle ?    s_in_b :    s_in[lev];
+              MultiFab&   s_out_mf = shuffle ?   s_out_b :   s_out[lev];
+        const MultiFab& p0_cart_mf = shuffle ? p0_cart_b : p0_cart[lev];
+        const MultiFab&  source_mf = shuffle ?  source_b :  source[lev];
         
         // create mask assuming refinement ratio = 2
         int finelev = lev+1;
@@ -304,6 +439,28 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
         const BoxArray& fba = s_in[finelev].boxArray();
         const iMultiFab& mask = makeFineMask(s_in_mf, fba, IntVect(2));
         
+        // measure the cost of the burn for load balancing
+        const bool record_cost = burner_lb_type > 0;
+        if (record_cost && !(burn_cost[lev].ok() && isMFIterSafe(burn_cost[lev], s_in_mf))) {
+            burn_cost[lev].define(s_in_mf.boxArray(), s_in_mf.DistributionMap(), 1, 0);
+            burn_cost[lev].setVal(0.);
+        }
+
+        int use_mask = !(lev==finest_level);
+
+        // with burner_schedule_type = 1 the cells that are burned are
+        // collected into a work list and burned after the tile loop with
+        // dynamic scheduling, so the tile loop only passes through the rest
+        const bool use_work_list = burner_schedule_type == 1 && Gpu::notInLaunchRegion();
+
+        iMultiFab skip;
+        Vector<int> cell_box;
+        Vector<IntVect> cells;
+        if (use_work_list) {
+            MakeBurnerWorkList(s_in_mf, mask, use_mask, skip, cell_box, cells);
+        }
+        const iMultiFab& tile_mask = use_work_list ? skip : mask;
+        const int tile_use_mask = use_work_list ? 1 : use_mask;
 
         // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
@@ -314,7 +471,7 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
             // Get the index space of the valid region
             const Box& tileBox = mfi.tilebox();
 
-            int use_mask = !(lev==finest_level);
+            const Real strt_burn = record_cost ? ParallelDescriptor::second() : 0.0;
 
             // call fortran subroutine
             
@@ -326,7 +483,7 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
                     BL_TO_FORTRAN_ANYD(s_out_mf[mfi]),
                     BL_TO_FORTRAN_ANYD(source_mf[mfi]),
                     BL_TO_FORTRAN_ANYD(p0_cart_mf[mfi]), dt_in, time_in,
-                    BL_TO_FORTRAN_ANYD(mask[mfi]), use_mask);
+                    BL_TO_FORTRAN_ANYD(tile_mask[mfi]), tile_use_mask);
             } else {
 #pragma gpu box(tileBox)
                 burner_loop(AMREX_INT_ANYD(tileBox.loVect()), 
@@ -335,9 +492,59 @@ void Maestro::Burner(const Vector<MultiFab>& s_in,
                     BL_TO_FORTRAN_ANYD(s_in_mf[mfi]),
                     BL_TO_FORTRAN_ANYD(s_out_mf[mfi]),
                     BL_TO_FORTRAN_ANYD(source_mf[mfi]), 
-                    p0_vec.dataPtr(), dt_in, time_in,
-                    BL_TO_FORTRAN_ANYD(mask[mfi]), use_mask);
+                    p0_p, dt_in, time_in,
+                    BL_TO_FORTRAN_ANYD(tile_mask[mfi]), tile_use_mask);
             }
+
+            if (record_cost) {
+                AddBurnCost(lev, mfi, tileBox, strt_burn);
+            }
+        }
+
+        if (use_work_list) {
+            const int ncells = cells.size();
+            const int chunk_size = amrex::max(burner_chunk_size, 1);
+
+            // burn the work list one cell at a time; none of these cells
+            // are covered by finer cells, so the mask is not needed
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, chunk_size)
+#endif
+            for (int n = 0; n < ncells; ++n) {
+
+                const int K = cell_box[n];
+                const Box cellBox(cells[n], cells[n]);
+
+                const Real strt_burn = record_cost ? ParallelDescriptor::second() : 0.0;
+
+                if (spherical) {
+                    burner_loop_sphr(AMREX_INT_ANYD(cellBox.loVect()), 
+                        AMREX_INT_ANYD(cellBox.hiVect()),
+                        BL_TO_FORTRAN_ANYD(s_in_mf[K]),
+                        BL_TO_FORTRAN_ANYD(s_out_mf[K]),
+                        BL_TO_FORTRAN_ANYD(source_mf[K]),
+                        BL_TO_FORTRAN_ANYD(p0_cart_mf[K]), dt_in, time_in,
+                        BL_TO_FORTRAN_ANYD(mask[K]), 0);
+                } else {
+                    burner_loop(AMREX_INT_ANYD(cellBox.loVect()), 
+                        AMREX_INT_ANYD(cellBox.hiVect()),
+                        lev,
+                        BL_TO_FORTRAN_ANYD(s_in_mf[K]),
+                        BL_TO_FORTRAN_ANYD(s_out_mf[K]),
+                        BL_TO_FORTRAN_ANYD(source_mf[K]), 
+                        p0_p, dt_in, time_in,
+                        BL_TO_FORTRAN_ANYD(mask[K]), 0);
+                }
+
+                if (record_cost) {
+                    const Dim3 c = cells[n].dim3();
+                    burn_cost[lev].array(K)(c.x,c.y,c.z) += ParallelDescriptor::second() - strt_burn;
+                }
+            }
+        }
+
+        if (shuffle) {
+            s_out[lev].ParallelCopy(s_out_b, 0, 0, Nscal);
         }
     }
 }
@@ -389,3 +596,168 @@ Maestro::MakeReactionRates (Vector<MultiFab>& rho_omegadot,
     }
     
 }
+
+
+// collect the cells of s_in_mf that the burner will actually burn into a
+// work list of (box index, cell) pairs.  On return, skip is 1 for these
+// cells and for the cells covered by finer grids, so a tile pass of the
+// burner with skip as its mask only passes the remaining cells through.
+void
+Maestro::MakeBurnerWorkList (const MultiFab& s_in_mf,
+                             const iMultiFab& mask,
+                             const int use_mask,
+                             iMultiFab& skip,
+                             Vector<int>& cell_box,
+                             Vector<IntVect>& cells)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::MakeBurnerWorkList()", MakeBurnerWorkList);
+
+    skip.define(s_in_mf.boxArray(), s_in_mf.DistributionMap(), 1, 0);
+
+    // loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for ( MFIter mfi(s_in_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+
+        // Get the index space of the valid region
+        const Box& tileBox = mfi.tilebox();
+
+        burner_flag_cells(AMREX_INT_ANYD(tileBox.loVect()), AMREX_INT_ANYD(tileBox.hiVect()),
+                          BL_TO_FORTRAN_ANYD(s_in_mf[mfi]),
+                          BL_TO_FORTRAN_ANYD(mask[mfi]), use_mask,
+                          BL_TO_FORTRAN_ANYD(skip[mfi]));
+    }
+
+    // gather the flagged cells that are not covered by finer cells
+    cell_box.clear();
+    cells.clear();
+
+    for ( MFIter mfi(skip); mfi.isValid(); ++mfi ) {
+
+        const Box& validBox = mfi.validbox();
+        const Array4<const int> skip_arr = skip.array(mfi);
+        const Array4<const int> mask_arr = mask.array(mfi);
+        const auto lo = amrex::lbound(validBox);
+        const auto hi = amrex::ubound(validBox);
+
+        for (auto k = lo.z; k <= hi.z; ++k) {
+            for (auto j = lo.y; j <= hi.y; ++j) {
+                for (auto i = lo.x; i <= hi.x; ++i) {
+                    if (skip_arr(i,j,k) == 1 && (use_mask == 0 || mask_arr(i,j,k) == 0)) {
+                        cell_box.push_back(mfi.index());
+                        cells.push_back(IntVect(AMREX_D_DECL(i,j,k)));
+                    }
+                }
+            }
+        }
+    }
+}
+
+// add the wall time spent burning tileBox since strt_time to burn_cost,
+// spread evenly over the cells of the tile
+void
+Maestro::AddBurnCost (const int lev, const MFIter& mfi,
+                      const Box& tileBox, const Real strt_time)
+{
+    // make sure the burn has finished before reading the clock
+    Gpu::synchronize();
+
+    const Real cost = (ParallelDescriptor::second() - strt_time) / Real(tileBox.numPts());
+    const Array4<Real> cost_arr = burn_cost[lev].array(mfi);
+
+    AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
+        cost_arr(i,j,k) += cost;
+    });
+}
+
+// use the burner cost accumulated since the last call to build a new
+// distribution of the grids, then either move the state onto it
+// (burner_lb_type = 1) or burn on it (burner_lb_type = 2)
+void
+Maestro::LoadBalanceBurner ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::LoadBalanceBurner()", LoadBalanceBurner);
+
+    if (burner_lb_type != 1 && burner_lb_type != 2) {
+        Abort("LoadBalanceBurner: burner_lb_type must be 1 or 2");
+    }
+
+    // only move data around for a worthwhile improvement
+    const Real min_gain = 0.05;
+
+    for (int lev=0; lev<=finest_level; ++lev) {
+
+        // nothing has been measured on the current grids yet
+        if (!burn_cost[lev].ok() || burn_cost[lev].boxArray() != grids[lev]) {
+            continue;
+        }
+
+        const int nboxes = grids[lev].size();
+
+        // total cost of each box
+        Vector<Real> box_cost(nboxes, 0.0);
+        Gpu::synchronize();
+        for (MFIter mfi(burn_cost[lev]); mfi.isValid(); ++mfi) {
+            const Box& validBox = mfi.validbox();
+            const Array4<const Real> cost_arr = burn_cost[lev].array(mfi);
+            const auto lo = amrex::lbound(validBox);
+            const auto hi = amrex::ubound(validBox);
+
+            Real cost = 0.0;
+            for (auto k = lo.z; k <= hi.z; ++k) {
+                for (auto j = lo.y; j <= hi.y; ++j) {
+                    for (auto i = lo.x; i <= hi.x; ++i) {
+                        cost += cost_arr(i,j,k);
+                    }
+                }
+            }
+            box_cost[mfi.index()] = cost;
+        }
+        ParallelDescriptor::ReduceRealSum(box_cost.dataPtr(), nboxes);
+
+        const DistributionMapping& dm_old = burn_cost[lev].DistributionMap();
+        const DistributionMapping dm_new = burner_lb_use_sfc ?
+            DistributionMapping::makeSFC(burn_cost[lev]) :
+            DistributionMapping::makeKnapSack(burn_cost[lev]);
+
+        const Real imbalance_old = BurnerImbalance(box_cost, dm_old);
+        const Real imbalance_new = BurnerImbalance(box_cost, dm_new);
+        const bool remap = imbalance_new < (1.0 - min_gain) * imbalance_old;
+
+        if (maestro_verbose > 0) {
+            Print() << "Burner load balance at level " << lev
+                    << ": imbalance (max/mean rank cost) measured = " << imbalance_old
+                    << ", predicted after remap = " << imbalance_new
+                    << (remap ? "" : " (keeping current distribution)") << std::endl;
+        }
+
+        if (remap) {
+            if (burner_lb_type == 1) {
+                RedistributeLevel(lev, dm_new);
+            } else {
+                burn_dmap[lev] = dm_new;
+            }
+        }
+
+        // start measuring again
+        burn_cost[lev].clear();
+    }
+}
+
+Real
+Maestro::BurnerImbalance (const Vector<Real>& box_cost,
+                          const DistributionMapping& dm) const
+{
+    Vector<Real> rank_cost(ParallelDescriptor::NProcs(), 0.0);
+    for (auto i = 0; i < box_cost.size(); ++i) {
+        rank_cost[dm[i]] += box_cost[i];
+    }
+
+    const Real max_cost = *std::max_element(rank_cost.begin(), rank_cost.end());
+    const Real avg_cost = std::accumulate(rank_cost.begin(), rank_cost.end(), 0.0) / rank_cost.size();
+
+    return avg_cost > 0.0 ? max_cost / avg_cost : 1.0;
+}
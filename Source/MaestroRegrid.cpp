@@ -60,6 +60,15 @@ Maestro::Regrid ()
         rho0_temp.copy(rho0_old);
     }
 
+    // the pooled scratch buffers live on the old grids
+    if (scratch_pool_stats) {
+        scratch_pool.PrintStats("before regrid");
+    }
+    scratch_pool.Flush();
+
+    // the linear operators are rebuilt on the new grids
+    ClearLinOps();
+
     // regrid could add newly refine levels (if finest_level < max_level)
     // so we save the previous finest level index
     regrid(0, t_old);
@@ -75,6 +84,9 @@ Maestro::Regrid ()
 
     if (spherical) {
         MakeNormal();
+        MakeRadiusCache();
+        // Average rebuilds this for the new grids
+        spherical_averager.clear();
         if (use_exact_base_state) {
             Abort("MaestroRegrid.cpp: need to fill cell_cc_to_r for spherical & exact_base_state");
         }
@@ -263,6 +275,18 @@ Maestro::RemakeLevel (int lev, Real time, const BoxArray& ba,
 
     std::swap(           w0_cart_state,            w0_cart[lev]);
     std::swap(rhcc_for_nodalproj_state, rhcc_for_nodalproj[lev]);
+
+    // with warm-started projections pi seeds the next nodal solve,
+    // and the last MAC potential the next MAC solve
+    if (warm_start_projections) {
+        FillPatchNodal(lev, pi_state, pi);
+        if (macphi_guess[lev].ok()) {
+            MultiFab macphi_guess_state(ba, dm, 1, 0);
+            FillPatch(lev, time, macphi_guess_state, macphi_guess, macphi_guess,
+                      0, 0, 1, 0, bcs_f);
+            std::swap(macphi_guess_state, macphi_guess[lev]);
+        }
+    }
     std::swap(                pi_state,                 pi[lev]);
 #ifdef SDC
     std::swap(intra_state,intra[lev]);
@@ -275,11 +299,21 @@ Maestro::RemakeLevel (int lev, Real time, const BoxArray& ba,
         iMultiFab cell_cc_to_r_state(ba, dm, 1, ng_c);
         std::swap(normal_state, normal[lev]);
         std::swap(cell_cc_to_r_state, cell_cc_to_r[lev]);
+        // the cached radii belong to the old grids
+        cell_cc_radius[lev].clear();
+        for (auto& f : face_radius[lev]) { f.clear(); }
     }
 
     if (lev > 0 && reflux_type == 2) {
         flux_reg_s[lev].reset(new FluxRegister(ba, dm, refRatio(lev-1), lev, Nscal));
     }
+
+    // the burner costs were measured on the old grids
+    burn_cost[lev].clear();
+    burn_dmap[lev] = dm;
+
+    // the cached EOS evaluations are rebuilt on the new grids
+    eos_cache[lev].clear();
 }
 
 // within a call to AmrCore::regrid, this function fills in data at a level
@@ -311,17 +345,30 @@ Maestro::MakeNewLevelFromCoarse (int lev, Real time, const BoxArray& ba,
     if (spherical) {
         normal      [lev].define(ba, dm, 3, 1);
         cell_cc_to_r[lev].define(ba, dm, 1, 0);
+        cell_cc_radius[lev].clear();
+        for (auto& f : face_radius[lev]) { f.clear(); }
     }
 
     if (lev > 0 && reflux_type == 2) {
         flux_reg_s[lev].reset(new FluxRegister(ba, dm, refRatio(lev-1), lev, Nscal));
     }
 
+    burn_cost[lev].clear();
+    burn_dmap[lev] = dm;
+
     FillCoarsePatch(lev, time,     sold[lev],     sold,     sold, 0, 0,          Nscal, bcs_s);
     FillCoarsePatch(lev, time,     uold[lev],     uold,     uold, 0, 0, AMREX_SPACEDIM, bcs_u, 1);
     FillCoarsePatch(lev, time, S_cc_old[lev], S_cc_old, S_cc_old, 0, 0,              1, bcs_f);
     FillCoarsePatch(lev, time,      gpi[lev],      gpi,      gpi, 0, 0, AMREX_SPACEDIM, bcs_f);
     FillCoarsePatch(lev, time,     dSdt[lev],     dSdt,     dSdt, 0, 0,              1, bcs_f);
+    if (warm_start_projections) {
+        FillCoarsePatchNodal(lev, pi[lev], pi);
+        if (macphi_guess[lev-1].ok()) {
+            macphi_guess[lev].define(ba, dm, 1, 0);
+            FillCoarsePatch(lev, time, macphi_guess[lev], macphi_guess, macphi_guess,
+                            0, 0, 1, bcs_f);
+        }
+    }
 #ifdef SDC
     FillCoarsePatch(lev, time,    intra[lev],    intra,    intra, 0, 0,          Nscal, bcs_f);
 #endif
@@ -350,14 +397,110 @@ Maestro::ClearLevel (int lev)
 #ifdef SDC
     intra[lev].clear();
 #endif
+    macphi_guess[lev].clear();
     if (spherical) {
         normal[lev].clear();
         cell_cc_to_r[lev].clear();
+        cell_cc_radius[lev].clear();
+        for (auto& f : face_radius[lev]) { f.clear(); }
     }
 
+    burn_cost[lev].clear();
+    burn_dmap[lev] = DistributionMapping();
+    eos_cache[lev].clear();
+
     flux_reg_s[lev].reset(nullptr);
 }
 
+// move the persistent data at level lev onto a new distribution map,
+// keeping the same grids.  Valid and ghost data are copied as they are,
+// so nothing needs to be re-filled afterwards.
+void
+Maestro::RedistributeLevel (int lev, const DistributionMapping& dm)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::RedistributeLevel()", RedistributeLevel);
+
+    const BoxArray& ba = grids[lev];
+
+    auto redistribute = [&dm] (auto& mf)
+    {
+        if (!mf.ok()) {
+            return;
+        }
+        const int ng = mf.nGrow();
+        std::remove_reference_t<decltype(mf)> mf_new(mf.boxArray(), dm, mf.nComp(), ng);
+        mf_new.ParallelCopy(mf, 0, 0, mf.nComp(), ng, ng);
+        std::swap(mf_new, mf);
+    };
+
+    redistribute(sold[lev]);
+    redistribute(snew[lev]);
+    redistribute(uold[lev]);
+    redistribute(unew[lev]);
+    redistribute(S_cc_old[lev]);
+    redistribute(S_cc_new[lev]);
+    redistribute(gpi[lev]);
+    redistribute(dSdt[lev]);
+    redistribute(w0_cart[lev]);
+    redistribute(rhcc_for_nodalproj[lev]);
+    redistribute(pi[lev]);
+#ifdef SDC
+    redistribute(intra[lev]);
+#endif
+    redistribute(macphi_guess[lev]);
+    if (spherical) {
+        redistribute(normal[lev]);
+        redistribute(cell_cc_to_r[lev]);
+        redistribute(cell_cc_radius[lev]);
+        for (auto& f : face_radius[lev]) {
+            redistribute(f);
+        }
+    }
+    redistribute(burn_cost[lev]);
+    redistribute(eos_cache[lev]);
+
+    if (lev > 0 && reflux_type == 2) {
+        flux_reg_s[lev].reset(new FluxRegister(ba, dm, refRatio(lev-1), lev, Nscal));
+    }
+
+    SetDistributionMap(lev, dm);
+    burn_dmap[lev] = dm;
+
+    // the pooled scratch buffers and linear operators live on the old
+    // distribution
+    scratch_pool.Flush();
+    ClearLinOps();
+}
+
+void
+Maestro::ClearLinOps ()
+{
+    mac_linop.reset();
+    nodal_linop.reset();
+    thermal_linop.reset();
+    thermal_apply_linop.reset();
+    linop_grids.clear();
+    linop_dmap.clear();
+}
+
+void
+Maestro::CheckLinOps ()
+{
+    // BoxArray and DistributionMapping comparisons are cheap when
+    // nothing has changed, since the copies share their data
+    bool same = linop_grids.size() == finest_level+1;
+    for (int lev = 0; same && lev <= finest_level; ++lev) {
+        same = linop_grids[lev] == grids[lev] && linop_dmap[lev] == dmap[lev];
+    }
+
+    if (!same) {
+        ClearLinOps();
+        linop_grids.assign(grids.begin(), grids.begin()+finest_level+1);
+        linop_dmap.assign(dmap.begin(), dmap.begin()+finest_level+1);
+    }
+}
+
 void
 Maestro::RegridBaseState(BaseState<Real>& base_s, const bool is_edge)
 {
@@ -4,6 +4,26 @@
 
 using namespace amrex;
 
+MultiFab*
+Maestro::EOSCacheMF (int lev, const MultiFab& mf)
+{
+    if (!use_eos_cache ||
+        mf.boxArray() != grids[lev] ||
+        mf.DistributionMap() != dmap[lev]) {
+        return nullptr;
+    }
+
+    if (!eos_cache[lev].ok() ||
+        eos_cache[lev].boxArray() != grids[lev] ||
+        eos_cache[lev].DistributionMap() != dmap[lev]) {
+        // a negative density never matches, so every cell starts out empty
+        eos_cache[lev].define(grids[lev], dmap[lev], EOSCache::ncomp, 0);
+        eos_cache[lev].setVal(-1.);
+    }
+
+    return &eos_cache[lev];
+}
+
 void
 Maestro::TfromRhoH (Vector<MultiFab>& scal,
                     const BaseState<Real>& p0)
@@ -22,6 +42,9 @@ Maestro::TfromRhoH (Vector<MultiFab>& scal,
     const auto use_eos_e_instead_of_h_loc = use_eos_e_instead_of_h;
 
     for (int lev=0; lev<=finest_level; ++lev) {
+
+        MultiFab* eos_cache_mf = EOSCacheMF(lev, scal[lev]);
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -33,6 +56,8 @@ Maestro::TfromRhoH (Vector<MultiFab>& scal,
 
             const Array4<Real> state = scal[lev].array(mfi);
             const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+            const Array4<Real> eos_cache_arr = eos_cache_mf ?
+                eos_cache_mf->array(mfi) : Array4<Real>();
 
             if (use_eos_e_instead_of_h_loc) {
                 // (rho, (h->e)) --> T, p
@@ -53,6 +78,9 @@ Maestro::TfromRhoH (Vector<MultiFab>& scal,
 
                     state(i,j,k,Temp) = eos_state.T;
 
+                    if (eos_cache_arr) {
+                        eos_cache_store(eos_cache_arr, i, j, k, eos_state);
+                    }
                 });
             } else {
                 // (rho, h) --> T, p
@@ -71,6 +99,10 @@ Maestro::TfromRhoH (Vector<MultiFab>& scal,
                     eos(eos_input_rh, eos_state);
 
                     state(i,j,k,Temp) = eos_state.T;
+
+                    if (eos_cache_arr) {
+                        eos_cache_store(eos_cache_arr, i, j, k, eos_state);
+                    }
                 });
             }
         }
@@ -101,6 +133,8 @@ Maestro::TfromRhoP (Vector<MultiFab>& scal,
 
     for (int lev=0; lev<=finest_level; ++lev) {
 
+        MultiFab* eos_cache_mf = EOSCacheMF(lev, scal[lev]);
+
         // Loop over boxes (make sure mfi takes a cell-centered multifab as an argument)
 #ifdef _OPENMP
 #pragma omp parallel
@@ -111,6 +145,8 @@ Maestro::TfromRhoP (Vector<MultiFab>& scal,
             const Box& tileBox = mfi.tilebox();
             const Array4<Real> state = scal[lev].array(mfi);
             const Array4<const Real> p0_arr = p0_cart[lev].array(mfi);
+            const Array4<Real> eos_cache_arr = eos_cache_mf ?
+                eos_cache_mf->array(mfi) : Array4<Real>();
 
             // (rho, p) --> T
             AMREX_PARALLEL_FOR_3D(tileBox, i, j, k, {
@@ -137,6 +173,10 @@ Maestro::TfromRhoP (Vector<MultiFab>& scal,
                 if (updateRhoH) {
                     state(i,j,k,RhoH) = eos_state.rho * eos_state.h;
                 }
+
+                if (eos_cache_arr) {
+                    eos_cache_store(eos_cache_arr, i, j, k, eos_state);
+                }
             });
         }
     }
@@ -359,8 +399,8 @@ Maestro::HfromRhoTedge (Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
     BaseState<Real> rho0_halftime(base_geom.max_radial_level+1, base_geom.nr_fine);
     BaseState<Real> rhoh0_halftime(base_geom.max_radial_level+1, base_geom.nr_fine);
 
-    rho0_halftime.copy(0.5*(rho0_old + rho0_new));
-    rhoh0_halftime.copy(0.5*(rhoh0_old + rhoh0_new));
+    rho0_halftime.lincomb(0.5, rho0_old, 0.5, rho0_new);
+    rhoh0_halftime.lincomb(0.5, rhoh0_old, 0.5, rhoh0_new);
     
     Put1dArrayOnCart(rho0_halftime, rho0_cart, 0, 0, bcs_s, Rho);
     Put1dArrayOnCart(rhoh0_halftime, rhoh0_cart, 0, 0, bcs_s, RhoH);
@@ -373,8 +413,8 @@ Maestro::HfromRhoTedge (Vector<std::array< MultiFab, AMREX_SPACEDIM > >& sedge,
 
     if (!spherical) {
         CelltoEdge(tempbar, tempbar_edge);
-        rho0_edge.copy(0.5*(rho0_edge_old + rho0_edge_new));
-        rhoh0_edge.copy(0.5*(rhoh0_edge_old + rhoh0_edge_new));
+        rho0_edge.lincomb(0.5, rho0_edge_old, 0.5, rho0_edge_new);
+        rhoh0_edge.lincomb(0.5, rhoh0_edge_old, 0.5, rhoh0_edge_new);
     }
     
     Vector<MultiFab> rho0_edge_cart(finest_level+1);
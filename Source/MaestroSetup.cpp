@@ -32,6 +32,15 @@ Maestro::Setup ()
     // in _cpp_parameters
     read_method_params();
 
+    // choose the advection kernels specialized for the ppm_type,
+    // spherical, species_pred_type and enthalpy_pred_type read above
+    SelectFluxKernels();
+    SelectPPMKernel();
+    SelectUtransKernel();
+    SelectEdgeScalKernels();
+    SelectVelPredKernels();
+    SelectForceKernels();
+
     // Initialize the runtime parameters for any of the external microphysics
     // (in extern.f90)
     ExternInit();
@@ -205,6 +214,12 @@ Maestro::Setup ()
     rhcc_for_nodalproj.resize(max_level+1);
     normal            .resize(max_level+1);
     cell_cc_to_r      .resize(max_level+1);
+    cell_cc_radius    .resize(max_level+1);
+    face_radius       .resize(max_level+1);
+    burn_cost         .resize(max_level+1);
+    burn_dmap         .resize(max_level+1);
+    macphi_guess      .resize(max_level+1);
+    eos_cache         .resize(max_level+1);
 
     // stores fluxes at coarse-fine interface for synchronization
     // this will be sized "max_level+2"
@@ -548,3 +563,15 @@ Maestro::BCSetup()
         }
     } // end loop over directions
 }
+
+void
+Maestro::DefineScratch (MultiFab& mf, int lev, const BoxArray& ba,
+                        int ncomp, int ngrow)
+{
+    if (use_scratch_pool) {
+        MultiFab& buf = scratch_pool.Get(lev, ba, dmap[lev], ncomp, ngrow);
+        mf = MultiFab(buf, amrex::make_alias, 0, ncomp);
+    } else {
+        mf.define(ba, dmap[lev], ncomp, ngrow);
+    }
+}
@@ -43,18 +43,9 @@ Maestro::MakeExplicitThermal(Vector<MultiFab>& thermal,
     }
 
     //
-    // Compute thermal = div B grad phi using MLABecLaplacian class
+    // Compute thermal = div B grad phi using the cached MLABecLaplacian
     //
-    LPInfo info;
-
-    // turn off multigrid coarsening since no actual solve is performed
-    info.setMaxCoarseningLevel(0);
-
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int stencil_order = 2;
-    mlabec.setMaxOrder(stencil_order);
+    MLABecLaplacian& mlabec = ThermalApplyLinOp();
 
     if (temp_formulation == 1)
     {
@@ -157,18 +148,9 @@ Maestro::MakeExplicitThermalHterm(Vector<MultiFab>& thermal,
     }
 
     //
-    // Compute thermal = div B grad phi using MLABecLaplacian class
+    // Compute thermal = div B grad phi using the cached MLABecLaplacian
     //
-    LPInfo info;
-
-    // turn off multigrid coarsening since no actual solve is performed
-    info.setMaxCoarseningLevel(0);
-
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int stencil_order = 2;
-    mlabec.setMaxOrder(stencil_order);
+    MLABecLaplacian& mlabec = ThermalApplyLinOp();
 
         // 1. Compute div hcoeff grad h
         mlabec.setScalars(0.0, 1.0);
@@ -289,6 +271,8 @@ Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
         const auto buoyancy_cutoff_factor_l = buoyancy_cutoff_factor;
         const auto base_cutoff_density_l = base_cutoff_density;
 
+        MultiFab* eos_cache_mf = EOSCacheMF(lev, scal[lev]);
+
         // loop over boxes
 #ifdef _OPENMP
 #pragma omp parallel
@@ -297,12 +281,17 @@ Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
 
             // Get the index space of valid region
             const Box& gtbx = mfi.growntilebox(1);
+            // the grown tiles overlap, so only the valid cells of this
+            // tile go through the EOS cache
+            const Box& tileBox = mfi.tilebox();
 
             const Array4<Real> Tcoeff_arr = Tcoeff[lev].array(mfi);
             const Array4<Real> hcoeff_arr = hcoeff[lev].array(mfi);
             const Array4<Real> pcoeff_arr = pcoeff[lev].array(mfi);
             const Array4<Real> Xkcoeff_arr = Xkcoeff[lev].array(mfi);
             const Array4<const Real> scal_arr = scal[lev].array(mfi);
+            const Array4<Real> eos_cache_arr = eos_cache_mf ?
+                eos_cache_mf->array(mfi) : Array4<Real>();
 
             AMREX_PARALLEL_FOR_3D(gtbx, i, j, k, {
                 if (limit_conductivity_l && 
@@ -322,7 +311,11 @@ Maestro::MakeThermalCoeffs(const Vector<MultiFab>& scal,
                     }
 
                     // dens, temp and xmass are inputs
-                    eos(eos_input_rt, eos_state);
+                    if (tileBox.contains(IntVect(AMREX_D_DECL(i,j,k)))) {
+                        eos_rt_cached(eos_cache_arr, i, j, k, eos_state);
+                    } else {
+                        eos(eos_input_rt, eos_state);
+                    }
                     conductivity(eos_state);
 
                     Tcoeff_arr(i,j,k) = -eos_state.conductivity;
@@ -427,46 +420,9 @@ Maestro::ThermalConduct (const Vector<MultiFab>& s1,
     }
 
     //
-    // Set up implicit solve using MLABecLaplacian class
+    // Set up implicit solve using the cached MLABecLaplacian
     //
-    LPInfo info;
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
-
-    // set boundaries for mlabec using enthalpy bc's
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
-
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-    {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        }
-        else {
-            // lo-side BCs
-            if (bcs_s[RhoH].lo(idim) == BCType::foextrap) {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].lo(idim) == BCType::ext_dir) {
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            }
-
-            // hi-side BCs
-            if (bcs_s[RhoH].hi(idim) == BCType::foextrap) {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].hi(idim) == BCType::ext_dir) {
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            }
-        }
-    }
-
-    mlabec.setDomainBC(mlmg_lobc,mlmg_hibc);
+    MLABecLaplacian& mlabec = ThermalLinOp();
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &phi[lev]);
@@ -620,46 +576,9 @@ Maestro::ThermalConductSDC (int which_step,
     }
 
     //
-    // Set up implicit solve using MLABecLaplacian class
+    // Set up implicit solve using the cached MLABecLaplacian
     //
-    LPInfo info;
-    MLABecLaplacian mlabec(geom, grids, dmap, info);
-
-    // order of stencil
-    int linop_maxorder = 2;
-    mlabec.setMaxOrder(linop_maxorder);
-
-    // set boundaries for mlabec using enthalpy bc's
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
-    std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
-
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-    {
-        if (Geom(0).isPeriodic(idim)) {
-            mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
-        }
-        else {
-            // lo-side BCs
-            if (bcs_s[RhoH].lo(idim) == BCType::foextrap) {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].lo(idim) == BCType::ext_dir) {
-                mlmg_lobc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_lobc[idim] = LinOpBCType::Neumann;
-            }
-
-            // hi-side BCs
-            if (bcs_s[RhoH].hi(idim) == BCType::foextrap) {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            } else if (bcs_s[RhoH].hi(idim) == BCType::ext_dir) {
-                mlmg_hibc[idim] = LinOpBCType::Dirichlet;
-            } else {
-                mlmg_hibc[idim] = LinOpBCType::Neumann;
-            }
-        }
-    }
-
-    mlabec.setDomainBC(mlmg_lobc,mlmg_hibc);
+    MLABecLaplacian& mlabec = ThermalLinOp();
 
     for (int lev = 0; lev <= finest_level; ++lev) {
         mlabec.setLevelBC(lev, &phi[lev]);
@@ -710,3 +629,79 @@ Maestro::ThermalConductSDC (int which_step,
     // fill ghost cells
     FillPatch(t_old,s_hat,s_hat,s_hat,RhoH,RhoH,1,RhoH,bcs_s);
 }
+
+MLABecLaplacian&
+Maestro::ThermalLinOp ()
+{
+    CheckLinOps();
+
+    if (!thermal_linop) {
+        // timer for profiling
+        BL_PROFILE_VAR("Maestro::ThermalLinOp()", ThermalLinOp);
+
+        LPInfo info;
+        thermal_linop.reset(new MLABecLaplacian(geom, grids, dmap, info));
+
+        // order of stencil
+        int linop_maxorder = 2;
+        thermal_linop->setMaxOrder(linop_maxorder);
+
+        // set boundaries using enthalpy bc's
+        std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_lobc;
+        std::array<LinOpBCType,AMREX_SPACEDIM> mlmg_hibc;
+
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        {
+            if (Geom(0).isPeriodic(idim)) {
+                mlmg_lobc[idim] = mlmg_hibc[idim] = LinOpBCType::Periodic;
+            }
+            else {
+                // lo-side BCs
+                if (bcs_s[RhoH].lo(idim) == BCType::foextrap) {
+                    mlmg_lobc[idim] = LinOpBCType::Neumann;
+                } else if (bcs_s[RhoH].lo(idim) == BCType::ext_dir) {
+                    mlmg_lobc[idim] = LinOpBCType::Dirichlet;
+                } else {
+                    mlmg_lobc[idim] = LinOpBCType::Neumann;
+                }
+
+                // hi-side BCs
+                if (bcs_s[RhoH].hi(idim) == BCType::foextrap) {
+                    mlmg_hibc[idim] = LinOpBCType::Neumann;
+                } else if (bcs_s[RhoH].hi(idim) == BCType::ext_dir) {
+                    mlmg_hibc[idim] = LinOpBCType::Dirichlet;
+                } else {
+                    mlmg_hibc[idim] = LinOpBCType::Neumann;
+                }
+            }
+        }
+
+        thermal_linop->setDomainBC(mlmg_lobc,mlmg_hibc);
+    }
+
+    return *thermal_linop;
+}
+
+MLABecLaplacian&
+Maestro::ThermalApplyLinOp ()
+{
+    CheckLinOps();
+
+    if (!thermal_apply_linop) {
+        // timer for profiling
+        BL_PROFILE_VAR("Maestro::ThermalApplyLinOp()", ThermalApplyLinOp);
+
+        LPInfo info;
+
+        // turn off multigrid coarsening since no actual solve is performed
+        info.setMaxCoarseningLevel(0);
+
+        thermal_apply_linop.reset(new MLABecLaplacian(geom, grids, dmap, info));
+
+        // order of stencil
+        int stencil_order = 2;
+        thermal_apply_linop->setMaxOrder(stencil_order);
+    }
+
+    return *thermal_apply_linop;
+}
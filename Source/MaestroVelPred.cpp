@@ -157,18 +157,18 @@ Maestro::VelPred (Vector<MultiFab>& utilde,
                 }
             }
 
-            VelPredInterface(mfi,
-                             utilde_mf.array(mfi),
-                             ufull_mf.array(mfi),
-                             utrans_mf.array(mfi),
-                             vtrans_mf.array(mfi),
-                             Imu.array(mfi), Ipu.array(mfi),
-                             Imv.array(mfi), Ipv.array(mfi),
-                             ulx.array(mfi), urx.array(mfi),
-                             uimhx.array(mfi),
-                             uly.array(mfi), ury.array(mfi),
-                             uimhy.array(mfi),
-                             domainBox, dx);
+            (this->*vel_pred_interface)(mfi,
+                                        utilde_mf.array(mfi),
+                                        ufull_mf.array(mfi),
+                                        utrans_mf.array(mfi),
+                                        vtrans_mf.array(mfi),
+                                        Imu.array(mfi), Ipu.array(mfi),
+                                        Imv.array(mfi), Ipv.array(mfi),
+                                        ulx.array(mfi), urx.array(mfi),
+                                        uimhx.array(mfi),
+                                        uly.array(mfi), ury.array(mfi),
+                                        uimhy.array(mfi),
+                                        domainBox, dx);
 
             VelPredVelocities(mfi,
                              utilde_mf.array(mfi),
@@ -297,22 +297,22 @@ Maestro::VelPred (Vector<MultiFab>& utilde,
                 }
             }
             
-            VelPredInterface(mfi,
-                             utilde_mf.array(mfi),
-                             ufull_mf.array(mfi),
-                             utrans_mf.array(mfi),
-                             vtrans_mf.array(mfi),
-                             wtrans_mf.array(mfi),
-                             Imu.array(mfi), Ipu.array(mfi),
-                             Imv.array(mfi), Ipv.array(mfi),
-                             Imw.array(mfi), Ipw.array(mfi),
-                             ulx.array(mfi), urx.array(mfi),
-                             uimhx.array(mfi),
-                             uly.array(mfi), ury.array(mfi),
-                             uimhy.array(mfi),
-                             ulz.array(mfi), urz.array(mfi),
-                             uimhz.array(mfi),
-                             domainBox, dx);
+            (this->*vel_pred_interface)(mfi,
+                                        utilde_mf.array(mfi),
+                                        ufull_mf.array(mfi),
+                                        utrans_mf.array(mfi),
+                                        vtrans_mf.array(mfi),
+                                        wtrans_mf.array(mfi),
+                                        Imu.array(mfi), Ipu.array(mfi),
+                                        Imv.array(mfi), Ipv.array(mfi),
+                                        Imw.array(mfi), Ipw.array(mfi),
+                                        ulx.array(mfi), urx.array(mfi),
+                                        uimhx.array(mfi),
+                                        uly.array(mfi), ury.array(mfi),
+                                        uimhy.array(mfi),
+                                        ulz.array(mfi), urz.array(mfi),
+                                        uimhz.array(mfi),
+                                        domainBox, dx);
 
             VelPredTransverse(mfi,
                             utilde_mf.array(mfi),
@@ -330,28 +330,28 @@ Maestro::VelPred (Vector<MultiFab>& utilde,
                             wimhxy.array(mfi), wimhyx.array(mfi), 
                             domainBox, dx);
 
-            VelPredVelocities(mfi,
-                            utilde_mf.array(mfi),
-                            utrans_mf.array(mfi),
-                            vtrans_mf.array(mfi),
-                            wtrans_mf.array(mfi),
-                            umac_mf.array(mfi), vmac_mf.array(mfi),
-                            wmac_mf.array(mfi),
-                            w0macx_mf.array(mfi), 
-                            w0macy_mf.array(mfi),
-                            w0macz_mf.array(mfi),
-                            Imfx.array(mfi), Ipfx.array(mfi),
-                            Imfy.array(mfi), Ipfy.array(mfi),
-                            Imfz.array(mfi), Ipfz.array(mfi),
-                            ulx.array(mfi), urx.array(mfi),
-                            uly.array(mfi), ury.array(mfi),
-                            ulz.array(mfi), urz.array(mfi),
-                            uimhyz.array(mfi), uimhzy.array(mfi), 
-                            vimhxz.array(mfi), vimhzx.array(mfi), 
-                            wimhxy.array(mfi), wimhyx.array(mfi), 
-                            force_mf.array(mfi),
-                            w0_mf.array(mfi),
-                            domainBox, dx);
+            (this->*vel_pred_velocities)(mfi,
+                                       utilde_mf.array(mfi),
+                                       utrans_mf.array(mfi),
+                                       vtrans_mf.array(mfi),
+                                       wtrans_mf.array(mfi),
+                                       umac_mf.array(mfi), vmac_mf.array(mfi),
+                                       wmac_mf.array(mfi),
+                                       w0macx_mf.array(mfi), 
+                                       w0macy_mf.array(mfi),
+                                       w0macz_mf.array(mfi),
+                                       Imfx.array(mfi), Ipfx.array(mfi),
+                                       Imfy.array(mfi), Ipfy.array(mfi),
+                                       Imfz.array(mfi), Ipfz.array(mfi),
+                                       ulx.array(mfi), urx.array(mfi),
+                                       uly.array(mfi), ury.array(mfi),
+                                       ulz.array(mfi), urz.array(mfi),
+                                       uimhyz.array(mfi), uimhzy.array(mfi), 
+                                       vimhxz.array(mfi), vimhzx.array(mfi), 
+                                       wimhxy.array(mfi), wimhyx.array(mfi), 
+                                       force_mf.array(mfi),
+                                       w0_mf.array(mfi),
+                                       domainBox, dx);
         } // end MFIter loop
 
 #endif // AMREX_SPACEDIM
@@ -363,7 +363,8 @@ Maestro::VelPred (Vector<MultiFab>& utilde,
 
 #if (AMREX_SPACEDIM == 2)
 
-void 
+template <int ppm>
+void
 Maestro::VelPredInterface(const MFIter& mfi, 
                           Array4<const Real> const utilde,
                           Array4<const Real> const ufull,
@@ -400,7 +401,9 @@ Maestro::VelPredInterface(const MFIter& mfi,
     const Real hx = dx[0];
     const Real hy = dx[1];
 
-    const int ppm_type_local = ppm_type;
+    // ppm_type is a template parameter, so the tests of it in the kernels
+    // below are resolved at compile time
+    constexpr int ppm_type_local = ppm;
     const auto rel_eps_local = rel_eps;
 
     // x-direction
@@ -768,7 +771,8 @@ Maestro::VelPredVelocities(const MFIter& mfi,
 
 #else 
 
-void 
+template <int ppm>
+void
 Maestro::VelPredInterface(const MFIter& mfi, 
                           Array4<const Real> const utilde,
                           Array4<const Real> const ufull,
@@ -817,7 +821,9 @@ Maestro::VelPredInterface(const MFIter& mfi,
     const Real hy = dx[1];
     const Real hz = dx[2];
 
-    const int ppm_type_local = ppm_type;
+    // ppm_type is a template parameter, so the tests of it in the kernels
+    // below are resolved at compile time
+    constexpr int ppm_type_local = ppm;
     const auto rel_eps_local = rel_eps;
 
     // x-direction
@@ -1541,7 +1547,8 @@ Maestro::VelPredTransverse(const MFIter& mfi,
     });
 }
 
-void 
+template <int sph>
+void
 Maestro::VelPredVelocities(const MFIter& mfi, 
                             Array4<const Real> const utilde,
                             Array4<const Real> const utrans,
@@ -1605,7 +1612,10 @@ Maestro::VelPredVelocities(const MFIter& mfi,
     } 
 
     const int ppm_trace_forces_local = ppm_trace_forces;
-    const int spherical_local = spherical;
+
+    // spherical is a template parameter, so the tests of it in the kernels
+    // below are resolved at compile time
+    constexpr int spherical_local = sph;
 
     // x-direction
     AMREX_PARALLEL_FOR_3D(xbx, i, j, k, 
@@ -1833,3 +1843,25 @@ Maestro::VelPredVelocities(const MFIter& mfi,
 }
 
 #endif
+
+void
+Maestro::SelectVelPredKernels ()
+{
+    // timer for profiling
+    BL_PROFILE_VAR("Maestro::SelectVelPredKernels()", SelectVelPredKernels);
+
+    // the interface states only distinguish slopes from PPM, so ppm_type
+    // 2 shares the instance for 1
+    if (ppm_type == 0) {
+        vel_pred_interface = &Maestro::VelPredInterface<0>;
+    } else if (ppm_type == 1 || ppm_type == 2) {
+        vel_pred_interface = &Maestro::VelPredInterface<1>;
+    } else {
+        Abort("SelectVelPredKernels: invalid ppm_type");
+    }
+
+#if (AMREX_SPACEDIM == 3)
+    vel_pred_velocities = spherical ? &Maestro::VelPredVelocities<1>
+                                    : &Maestro::VelPredVelocities<0>;
+#endif
+}
@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <limits>
+#include <PlotFileStreamWriter.H>
+#include <AMReX_PlotFileUtil.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_FabConv.H>
+#include <AMReX_VisMF.H>
+
+using namespace amrex;
+
+namespace
+{
+    const std::string level_prefix {"Level_"};
+    const std::string mf_prefix {"Cell"};
+}
+
+PlotFileStreamWriter::PlotFileStreamWriter (const std::string& plotfilename_in,
+                                            const Vector<BoxArray>& ba_in,
+                                            const Vector<DistributionMapping>& dm_in,
+                                            const int ncomp_in)
+    : plotfilename(plotfilename_in),
+      ba(ba_in),
+      dm(dm_in),
+      ncomp(ncomp_in)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("PlotFileStreamWriter::PlotFileStreamWriter()", PlotFileStreamWriter);
+
+    // the components are written in place as raw native data
+    if (FArrayBox::getFormat() != FABio::FAB_NATIVE) {
+        Abort("PlotFileStreamWriter: requires the native FAB format");
+    }
+
+    const int nlevels = ba.size();
+    const int myproc = ParallelDescriptor::MyProc();
+    const int nprocs = ParallelDescriptor::NProcs();
+
+    // like VisMF, the ranks share VisMF::GetNOutFiles() data files per level
+    nfiles = std::max(1, std::min(VisMF::GetNOutFiles(), nprocs));
+
+    PreBuildDirectorHierarchy(plotfilename, level_prefix, nlevels, true);
+
+    data_offset.resize(nlevels);
+    fab_offset.resize(nlevels);
+    fab_min.resize(nlevels);
+    fab_max.resize(nlevels);
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+
+        const int nboxes = ba[lev].size();
+
+        data_offset[lev].resize(nboxes, -1);
+        fab_offset[lev].resize(nboxes, -1);
+        fab_min[lev].resize(nboxes*ncomp, std::numeric_limits<Real>::max());
+        fab_max[lev].resize(nboxes*ncomp, std::numeric_limits<Real>::lowest());
+
+        // the FAB headers of the FABs owned by this processor, each of
+        // which is followed by ncomp components of data
+        Vector<int> owned;
+        Vector<std::string> headers;
+        long nbytes = 0;
+        for (int k = 0; k < nboxes; ++k) {
+            if (dm[lev][k] != myproc) {
+                continue;
+            }
+
+            const Box& bx = ba[lev][k];
+
+            std::ostringstream header;
+            FArrayBox fab(bx, 1);
+            FArrayBox::getFABio().write_header(header, fab, ncomp);
+
+            owned.push_back(k);
+            headers.push_back(header.str());
+            nbytes += header.str().size() + long(bx.numPts())*ncomp*sizeof(Real);
+        }
+
+        // the processors sharing a data file lay out their FABs one after
+        // the other in the order of their ranks
+        Vector<long> proc_bytes(nprocs, 0);
+        proc_bytes[myproc] = nbytes;
+        ParallelDescriptor::ReduceLongSum(proc_bytes.dataPtr(), nprocs);
+
+        long offset = 0;
+        long file_bytes = 0;
+        for (int proc = 0; proc < nprocs; ++proc) {
+            if (FileNumber(proc) == FileNumber(myproc)) {
+                offset += proc < myproc ? proc_bytes[proc] : 0;
+                file_bytes += proc_bytes[proc];
+            }
+        }
+
+        const std::string filename = MultiFabFileFullPrefix(lev, plotfilename,
+                                                            level_prefix, mf_prefix)
+            + "_D_" + DataFileName(FileNumber(myproc));
+
+        // the first processor of each file creates it
+        if (myproc < nfiles && file_bytes > 0) {
+            std::ofstream DataFile(filename.c_str(), std::ofstream::out   |
+                                   std::ofstream::trunc |
+                                   std::ofstream::binary);
+            if (!DataFile.good()) {
+                FileOpenFailed(filename);
+            }
+        }
+        ParallelDescriptor::Barrier();
+
+        if (owned.empty()) {
+            continue;
+        }
+
+        // write the headers now
+        std::fstream DataFile(filename.c_str(), std::ios::in  |
+                              std::ios::out |
+                              std::ios::binary);
+        if (!DataFile.good()) {
+            FileOpenFailed(filename);
+        }
+
+        for (int n = 0; n < static_cast<int>(owned.size()); ++n) {
+            const int k = owned[n];
+
+            DataFile.seekp(offset, std::ios::beg);
+            DataFile << headers[n];
+
+            fab_offset[lev][k] = offset;
+            data_offset[lev][k] = offset + headers[n].size();
+
+            // leave room for the data, which WriteChunk fills in
+            offset = data_offset[lev][k] + long(ba[lev][k].numPts())*ncomp*sizeof(Real);
+        }
+
+        DataFile.close();
+        if (DataFile.fail()) {
+            Abort("PlotFileStreamWriter: failed to write " + filename);
+        }
+    }
+}
+
+void
+PlotFileStreamWriter::WriteChunk (const Vector<const MultiFab*>& mf,
+                                  const int comp)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("PlotFileStreamWriter::WriteChunk()", WriteChunk);
+
+    const int myproc = ParallelDescriptor::MyProc();
+
+    // the data is read directly from the FABs on the host
+    Gpu::synchronize();
+
+    for (int lev = 0; lev < ba.size(); ++lev) {
+
+        const int nc = mf[lev]->nComp();
+        AMREX_ASSERT(comp+nc <= ncomp);
+
+        if (mf[lev]->IndexArray().empty()) {
+            continue;
+        }
+
+        const std::string filename = MultiFabFileFullPrefix(lev, plotfilename,
+                                                            level_prefix, mf_prefix)
+            + "_D_" + DataFileName(FileNumber(myproc));
+
+        std::fstream DataFile(filename.c_str(), std::ios::in  |
+                              std::ios::out |
+                              std::ios::binary);
+        if (!DataFile.good()) {
+            FileOpenFailed(filename);
+        }
+
+        for (const int k : mf[lev]->IndexArray()) {
+
+            const FArrayBox& fab = (*mf[lev])[k];
+            const Box& bx = ba[lev][k];
+            const long npts = bx.numPts();
+
+            AMREX_ASSERT(fab.box() == bx);
+
+            for (int n = 0; n < nc; ++n) {
+                const Real* data = fab.dataPtr(n);
+
+                DataFile.seekp(data_offset[lev][k] + (comp+n)*npts*sizeof(Real),
+                               std::ios::beg);
+                DataFile.write(reinterpret_cast<const char*>(data), npts*sizeof(Real));
+
+                Real& mn = fab_min[lev][k*ncomp + comp+n];
+                Real& mx = fab_max[lev][k*ncomp + comp+n];
+                for (long i = 0; i < npts; ++i) {
+                    mn = amrex::min(mn, data[i]);
+                    mx = amrex::max(mx, data[i]);
+                }
+            }
+        }
+
+        DataFile.close();
+        if (DataFile.fail()) {
+            Abort("PlotFileStreamWriter: failed to write " + filename);
+        }
+    }
+}
+
+void
+PlotFileStreamWriter::Finish (const Vector<std::string>& varnames,
+                              const Vector<Geometry>& geom,
+                              const Real time,
+                              const Vector<int>& level_steps,
+                              const Vector<IntVect>& ref_ratio)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("PlotFileStreamWriter::Finish()", Finish);
+
+    const int nlevels = ba.size();
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+
+        const int nboxes = ba[lev].size();
+
+        // every grid is owned by exactly one processor, so summing the
+        // locally known values (zero elsewhere) gathers them
+        Vector<long> offset(nboxes, 0);
+        Vector<Real> fmin(nboxes*ncomp, 0.0);
+        Vector<Real> fmax(nboxes*ncomp, 0.0);
+        for (int k = 0; k < nboxes; ++k) {
+            if (fab_offset[lev][k] >= 0) {
+                offset[k] = fab_offset[lev][k];
+                for (int n = 0; n < ncomp; ++n) {
+                    fmin[k*ncomp+n] = fab_min[lev][k*ncomp+n];
+                    fmax[k*ncomp+n] = fab_max[lev][k*ncomp+n];
+                }
+            }
+        }
+        ParallelDescriptor::ReduceLongSum(offset.dataPtr(), nboxes, ioproc);
+        ParallelDescriptor::ReduceRealSum(fmin.dataPtr(), nboxes*ncomp, ioproc);
+        ParallelDescriptor::ReduceRealSum(fmax.dataPtr(), nboxes*ncomp, ioproc);
+
+        if (!ParallelDescriptor::IOProcessor()) {
+            continue;
+        }
+
+        // the VisMF header for this level
+        const std::string filename = MultiFabFileFullPrefix(lev, plotfilename,
+                                                            level_prefix, mf_prefix)
+            + "_H";
+
+        std::ofstream MFHeaderFile(filename.c_str(), std::ofstream::out   |
+                                   std::ofstream::trunc |
+                                   std::ofstream::binary);
+        if (!MFHeaderFile.good()) {
+            FileOpenFailed(filename);
+        }
+
+        MFHeaderFile.precision(17);
+
+        MFHeaderFile << int(VisMF::Header::Version_v1) << '\n';
+        MFHeaderFile << int(VisMF::NFiles) << '\n';
+        MFHeaderFile << ncomp << '\n';
+        MFHeaderFile << 0 << '\n';
+
+        ba[lev].writeOn(MFHeaderFile);
+        MFHeaderFile << '\n';
+
+        MFHeaderFile << nboxes << '\n';
+        for (int k = 0; k < nboxes; ++k) {
+            MFHeaderFile << "FabOnDisk: " << mf_prefix << "_D_" << DataFileName(FileNumber(dm[lev][k]))
+                         << ' ' << offset[k] << '\n';
+        }
+        MFHeaderFile << '\n';
+
+        MFHeaderFile << nboxes << ',' << ncomp << '\n';
+        for (int k = 0; k < nboxes; ++k) {
+            for (int n = 0; n < ncomp; ++n) {
+                MFHeaderFile << fmin[k*ncomp+n] << ',';
+            }
+            MFHeaderFile << '\n';
+        }
+        MFHeaderFile << '\n';
+
+        MFHeaderFile << nboxes << ',' << ncomp << '\n';
+        for (int k = 0; k < nboxes; ++k) {
+            for (int n = 0; n < ncomp; ++n) {
+                MFHeaderFile << fmax[k*ncomp+n] << ',';
+            }
+            MFHeaderFile << '\n';
+        }
+
+        MFHeaderFile.close();
+        if (MFHeaderFile.fail()) {
+            Abort("PlotFileStreamWriter: failed to write " + filename);
+        }
+    }
+
+    // the plotfile Header
+    if (ParallelDescriptor::IOProcessor()) {
+
+        const std::string filename = plotfilename + "/Header";
+
+        VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+
+        std::ofstream HeaderFile;
+        HeaderFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+        HeaderFile.open(filename.c_str(), std::ofstream::out   |
+                        std::ofstream::trunc |
+                        std::ofstream::binary);
+        if (!HeaderFile.good()) {
+            FileOpenFailed(filename);
+        }
+
+        WriteGenericPlotfileHeader(HeaderFile, nlevels, ba, varnames, geom, time,
+                                   level_steps, ref_ratio, "HyperCLaw-V1.1",
+                                   level_prefix, mf_prefix);
+    }
+
+    ParallelDescriptor::Barrier();
+}
+
+int
+PlotFileStreamWriter::FileNumber (const int proc) const
+{
+    return proc % nfiles;
+}
+
+std::string
+PlotFileStreamWriter::DataFileName (const int file)
+{
+    return Concatenate("", file, 5);
+}
@@ -0,0 +1,77 @@
+#include <ScratchPool.H>
+
+using namespace amrex;
+
+MultiFab&
+ScratchPool::Get(const int lev,
+                 const BoxArray& ba,
+                 const DistributionMapping& dm,
+                 const int ncomp,
+                 const int ngrow)
+{
+    // timer for profiling
+    BL_PROFILE_VAR("ScratchPool::Get()", Get);
+
+    for (auto& e : pool) {
+        if (!e.in_use &&
+            e.lev == lev &&
+            e.ncomp == ncomp &&
+            e.ngrow == ngrow &&
+            e.mf->ixType() == ba.ixType() &&
+            e.mf->boxArray() == ba &&
+            e.mf->DistributionMap() == dm) {
+            e.in_use = true;
+            bytes_reused += e.bytes;
+            ++num_reused;
+            return *e.mf;
+        }
+    }
+
+    // nothing suitable is free -- allocate a new buffer
+    Entry e;
+    e.lev = lev;
+    e.ncomp = ncomp;
+    e.ngrow = ngrow;
+    e.in_use = true;
+    e.mf.reset(new MultiFab(ba, dm, ncomp, ngrow));
+
+    e.bytes = 0;
+    for (MFIter mfi(*e.mf); mfi.isValid(); ++mfi) {
+        e.bytes += (*e.mf)[mfi].nBytes();
+    }
+
+    bytes_allocated += e.bytes;
+    ++num_allocated;
+
+    pool.push_back(std::move(e));
+    return *pool.back().mf;
+}
+
+void
+ScratchPool::ReleaseAll()
+{
+    for (auto& e : pool) {
+        e.in_use = false;
+    }
+}
+
+void
+ScratchPool::Flush()
+{
+    pool.clear();
+}
+
+void
+ScratchPool::PrintStats(const std::string& label) const
+{
+    long stats[4] = {bytes_allocated, bytes_reused, num_allocated, num_reused};
+    ParallelDescriptor::ReduceLongSum(stats, 4, ParallelDescriptor::IOProcessorNumber());
+
+    const Real mb = 1.0 / (1024.0*1024.0);
+
+    Print() << "ScratchPool stats (" << label << "):" << std::endl
+            << "   allocated: " << stats[2] << " buffers, "
+            << stats[0]*mb << " MB" << std::endl
+            << "   reused:    " << stats[3] << " buffers, "
+            << stats[1]*mb << " MB" << std::endl;
+}
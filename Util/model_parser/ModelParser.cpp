@@ -1,5 +1,7 @@
 #include <ModelParser.H>
 #include <cmath>
+#include <cstdlib>
+#include <algorithm>
 
 using namespace amrex;
 
@@ -23,7 +25,7 @@ ModelParser::ReadFile(const std::string& model_file_name)
     // now read in the number of variables
     std::getline(model_file, line);
     ipos = line.find('=') + 1;
-    static const int nvars_model_file = std::stoi(line.substr(ipos));
+    const int nvars_model_file = std::stoi(line.substr(ipos));
 
     RealVector vars_stored(nvars_model_file);
     std::vector<std::string> varnames_stored(nvars_model_file);
@@ -35,10 +37,54 @@ ModelParser::ReadFile(const std::string& model_file_name)
         varnames_stored[i] = maestro::trim(line.substr(ipos));
     }
 
+    // map each variable in the file to the model_state index of the
+    // variable that MAESTROeX cares about, or -1 if it is not one of them
+    IntVector model_var(nvars_model_file, -1);
+    std::vector<bool> found(nvars_model, false);
+
+    for (auto j = 0; j < nvars_model_file; ++j) {
+        if (varnames_stored[j] == "density") {
+            model_var[j] = idens_model;
+        } else if (varnames_stored[j] == "temperature") {
+            model_var[j] = itemp_model;
+        } else if (varnames_stored[j] == "pressure") {
+            model_var[j] = ipres_model;
+        } else {
+            for (auto comp = 0; comp < NumSpec; ++comp) {
+                if (varnames_stored[j] == spec_names_cxx[comp]) {
+                    model_var[j] = ispec_model+comp;
+                }
+            }
+        }
+
+        if (model_var[j] < 0) {
+            Print() << "WARNING: variable not found: " << maestro::trim(varnames_stored[j]) << std::endl;
+        } else {
+            found[model_var[j]] = true;
+        }
+    }
+
+    // were all the variable that we care about provided?
+    if (!found[idens_model]) {
+        Print() << "WARNING: density not provided in inputs file" << std::endl;
+    }
+    if (!found[itemp_model]) {
+        Print() << "WARNING: temperature not provided in inputs file" << std::endl;
+    }
+    if (!found[ipres_model]) {
+        Print() << "WARNING: pressure not provided in inputs file" << std::endl;
+    }
+    for (auto comp = 0; comp < NumSpec; ++comp) {
+        if (!found[ispec_model+comp]) {
+            Print() << "WARNING: " << maestro::trim(spec_names_cxx[comp]) << " not provided in inputs file" << std::endl;
+        }
+    }
+
     // alocate storage for the model data 
-    model_state.resize(npts_model);
-    for (auto i = 0; i < npts_model; ++i) {
-        model_state[i].resize(nvars_model);
+    model_state.resize(nvars_model);
+    for (auto j = 0; j < nvars_model; ++j) {
+        model_state[j].resize(npts_model);
+        std::fill(model_state[j].begin(), model_state[j].end(), 0.0);
     }
     model_r.resize(npts_model);
 
@@ -49,78 +95,22 @@ ModelParser::ReadFile(const std::string& model_file_name)
     // start reading in the data 
     for (auto i = 0; i < npts_model; ++i) {
         std::getline(model_file, line);
-        std::istringstream iss(line);
-        iss >> model_r[i];
-        for (auto j = 0; j < nvars_model_file; ++j) {
-            iss >> vars_stored[j];
-        }
 
-        for (auto j = 0; j < nvars_model; ++j) {
-            model_state[i][j] = 0.0;
-        }
+        const char* pos = line.c_str();
+        char* next;
 
-        // make sure that each of the variables that MAESTROeX cares about
-        // are found
-        bool found_dens = false;
-        bool found_temp = false;
-        bool found_pres = false;
-        std::vector<bool> found_spec(NumSpec);
-        for (auto comp = 0; comp < NumSpec; ++comp) {
-            found_spec[comp] = false;
+        model_r[i] = std::strtod(pos, &next);
+        pos = next;
+        for (auto j = 0; j < nvars_model_file; ++j) {
+            vars_stored[j] = std::strtod(pos, &next);
+            pos = next;
         }
 
         for (auto j = 0; j < nvars_model_file; ++j) {
-            // keep track of whether the current variable from the model 
-            // file is the one that MAESTROeX cares about
-
-            bool found_model = false;
-
-            if (varnames_stored[j] == "density") {
-                model_state[i][idens_model] = vars_stored[j];
-                found_model = true;
-                found_dens = true;
-            } else if (varnames_stored[j] == "temperature") {
-                model_state[i][itemp_model] = vars_stored[j];
-                found_model = true;
-                found_temp = true;
-            } else if (varnames_stored[j] == "pressure") {
-                model_state[i][ipres_model] = vars_stored[j];
-                found_model = true;
-                found_pres = true;
-            } else {
-                for (auto comp = 0; comp < NumSpec; ++comp) {
-                    if (varnames_stored[j] == spec_names_cxx[comp]) {
-                        model_state[i][ispec_model+comp] = vars_stored[j];
-                        found_model = true;
-                        found_spec[comp] = true;
-                    }
-                }
-            }
-
-            // is the current variable from the model file one that we
-            // care about?
-            if (!found_model && i == 0) {
-                Print() << "WARNING: variable not found: " << maestro::trim(varnames_stored[j]) << std::endl;
+            if (model_var[j] >= 0) {
+                model_state[model_var[j]][i] = vars_stored[j];
             }
         }
-
-        // were all the variable that we care about provided?
-        if (i == 0) {
-            if (!found_dens) {
-                Print() << "WARNING: density not provided in inputs file" << std::endl;
-            }
-            if (!found_temp) {
-                Print() << "WARNING: temperature not provided in inputs file" << std::endl;
-            }
-            if (!found_pres) {
-                Print() << "WARNING: pressure not provided in inputs file" << std::endl;
-            }
-            for (auto comp = 0; comp < NumSpec; ++comp) {
-                if (!found_spec[comp]) {
-                    Print() << "WARNING: " << maestro::trim(spec_names_cxx[comp]) << " not provided in inputs file" << std::endl;
-                }
-            }
-        }        
     }
 
     model_initialized = true;
@@ -134,13 +124,29 @@ ModelParser::Interpolate(const Real r, const int ivar,
     // variables (model_state), to find the value of model_var at point
     // r using linear interpolation.
 
-    Real interpolate = 0.0;
+    return InterpolateAt(FindIndex(r), r, ivar, interpolate_top);
+}
+
+void
+ModelParser::InterpolateAll(const Real r, Real* out,
+                            bool interpolate_top)
+{
+    const int i = FindIndex(r);
 
-    // find the location in the coordinate array where we want to interpolate
-    int i = 0;
-    while (model_r[i] < r && i <= npts_model) {
-        i++;
+    for (auto ivar = 0; ivar < nvars_model; ++ivar) {
+        out[ivar] = InterpolateAt(i, r, ivar, interpolate_top);
     }
+}
+
+int
+ModelParser::FindIndex(const Real r) const
+{
+    // find the location in the coordinate array where we want to
+    // interpolate: the first point with model_r >= r (model_r is
+    // increasing), then the nearer of it and the point below
+    int i = std::lower_bound(model_r.begin(), model_r.begin() + npts_model, r)
+        - model_r.begin();
+
     if (i > 0 && i < npts_model) {
         if (fabs(r - model_r[i-1]) < fabs(r - model_r[i])) {
             i--;
@@ -149,47 +155,58 @@ ModelParser::Interpolate(const Real r, const int ivar,
         i--;
     }
 
+    return i;
+}
+
+Real
+ModelParser::InterpolateAt(const int i, const Real r, const int ivar,
+                           bool interpolate_top) const
+{
+    const RealVector& var = model_state[ivar];
+
+    Real interpolate = 0.0;
+
     if (i == 0) {
-        Real slope = (model_state[i+1][ivar] - model_state[i][ivar]) / (model_r[i+1] - model_r[i]);
-        interpolate = slope * (r - model_r[i]) + model_state[i][ivar];
+        Real slope = (var[i+1] - var[i]) / (model_r[i+1] - model_r[i]);
+        interpolate = slope * (r - model_r[i]) + var[i];
 
         // safety check to make sure interpolate lies within the bounding points
-        Real minvar = min(model_state[i+1][ivar], model_state[i][ivar]);
-        Real maxvar = max(model_state[i+1][ivar], model_state[i][ivar]);
+        Real minvar = min(var[i+1], var[i]);
+        Real maxvar = max(var[i+1], var[i]);
         interpolate = max(interpolate, minvar);
         interpolate = min(interpolate, maxvar);
     } else if (i == npts_model - 1) {
-        Real slope = (model_state[i][ivar] - model_state[i-1][ivar]) / (model_r[i] - model_r[i-1]);
-        interpolate = slope * (r - model_r[i]) + model_state[i][ivar];
+        Real slope = (var[i] - var[i-1]) / (model_r[i] - model_r[i-1]);
+        interpolate = slope * (r - model_r[i]) + var[i];
 
         // safety check to make sure interpolate lies within the bounding points
         if (!interpolate_top) {
-            Real minvar = min(model_state[i][ivar], model_state[i-1][ivar]);
-            Real maxvar = max(model_state[i][ivar], model_state[i-1][ivar]);
+            Real minvar = min(var[i], var[i-1]);
+            Real maxvar = max(var[i], var[i-1]);
             interpolate = max(interpolate, minvar);
             interpolate = min(interpolate, maxvar);
         }
     } else {
         if (r >= model_r[i]) {
-            Real slope = (model_state[i+1][ivar] - model_state[i][ivar]) / (model_r[i+1] - model_r[i]);
-            interpolate = slope * (r - model_r[i]) + model_state[i][ivar];
+            Real slope = (var[i+1] - var[i]) / (model_r[i+1] - model_r[i]);
+            interpolate = slope * (r - model_r[i]) + var[i];
 
             // safety check to make sure interpolate lies within the bounding points
-            Real minvar = min(model_state[i+1][ivar], model_state[i][ivar]);
-            Real maxvar = max(model_state[i+1][ivar], model_state[i][ivar]);
+            Real minvar = min(var[i+1], var[i]);
+            Real maxvar = max(var[i+1], var[i]);
             interpolate = max(interpolate, minvar);
             interpolate = min(interpolate, maxvar);
         } else {
-            Real slope = (model_state[i][ivar] - model_state[i-1][ivar]) / (model_r[i] - model_r[i-1]);
-            interpolate = slope * (r - model_r[i]) + model_state[i][ivar];
+            Real slope = (var[i] - var[i-1]) / (model_r[i] - model_r[i-1]);
+            interpolate = slope * (r - model_r[i]) + var[i];
 
             // safety check to make sure interpolate lies within the bounding points
-            Real minvar = min(model_state[i][ivar], model_state[i-1][ivar]);
-            Real maxvar = max(model_state[i][ivar], model_state[i-1][ivar]);
+            Real minvar = min(var[i], var[i-1]);
+            Real maxvar = max(var[i], var[i-1]);
             interpolate = max(interpolate, minvar);
             interpolate = min(interpolate, maxvar);
         }
     }
 
     return interpolate;
-}
\ No newline at end of file
+}